@@ -0,0 +1,795 @@
+#include <Bench.hpp>
+
+#include <AlignedArray.hpp>
+#include <Array.hpp>
+#include <BitArray.hpp>
+#include <Encoding.hpp>
+#include <EytzingerArray.hpp>
+#include <HashMap.hpp>
+#include <Json.hpp>
+#include <LineIndex.hpp>
+#include <MdArray.hpp>
+#include <MpmcQueue.hpp>
+#include <Pipeline.hpp>
+#include <SmallVector.hpp>
+#include <SoAArray.hpp>
+#include <SpscRing.hpp>
+#include <String.hpp>
+#include <StringSort.hpp>
+#include <StringTable.hpp>
+#include <ThreadPool.hpp>
+#include <Vector.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct Body {
+    float x, y, z;
+    float vx, vy, vz;
+    float mass, charge;
+};
+
+size_t textbookLevenshtein(TAS::String const &a, TAS::String const &b) {
+    std::vector<size_t> prev(b.size() + 1), cur(b.size() + 1);
+    for (size_t j = 0; j <= b.size(); j++) prev[j] = j;
+    for (size_t i = 1; i <= a.size(); i++)
+    {
+        cur[0] = i;
+        for (size_t j = 1; j <= b.size(); j++)
+        {
+            cur[j] = std::min({prev[j] + 1, cur[j - 1] + 1, prev[j - 1] + (a[i - 1] != b[j - 1])});
+        }
+        std::swap(prev, cur);
+    }
+    return prev[b.size()];
+}
+
+void Bench() {
+
+    // TAS::Array Benchmarks
+    BENCH_INIT(TAS::Array)
+    constexpr size_t floatCount = 1 << 22;
+    std::unique_ptr<TAS::Array<float, floatCount>> floats(new TAS::Array<float, floatCount>(1.5f));
+
+    std::function<float(float const &)> affine = [](float const &x) { return x * 0.5f + 1.0f; };
+    double indirect = benchmark("transformAndCopy, std::function", sizeof(*floats), 10, [&]() {
+        floats->transformAndCopy(affine);
+    });
+    double inlined = benchmark("transformAndCopy, lambda", sizeof(*floats), 10, [&]() {
+        floats->transformAndCopy([](float const &x) { return x * 0.5f + 1.0f; });
+    });
+    std::cout << "speedup: " << indirect / inlined << "x\n";
+
+    std::function<void(float const &)> accumulate;
+    float total{};
+    accumulate = [&total](float const &x) { total += x; };
+    indirect = benchmark("forEach sum, std::function", sizeof(*floats), 10, [&]() {
+        floats->forEach(accumulate);
+        doNotOptimize(total);
+    });
+    inlined = benchmark("forEach sum, lambda", sizeof(*floats), 10, [&]() {
+        float sum{};
+        floats->forEach([&sum](float const &x) { sum += x; });
+        doNotOptimize(sum);
+    });
+    std::cout << "speedup: " << indirect / inlined << "x\n";
+
+    constexpr size_t bigCount = 1 << 24;
+    std::unique_ptr<TAS::Array<float, bigCount>> big(new TAS::Array<float, bigCount>(1.5f));
+    std::cout << TAS::ThreadPool::global().size() + 1 << " threads\n";
+    double serialTransform = benchmark("transformAndCopy, 1 << 24 floats", sizeof(*big), 5, [&]() {
+        big->transformAndCopy([](float const &x) { return x * 0.5f + 1.0f; });
+    });
+    double parallelTransform = benchmark("parallelTransformAndCopy, 1 << 24 floats", sizeof(*big), 5, [&]() {
+        TAS::parallelTransformAndCopy(*big, [](float const &x) { return x * 0.5f + 1.0f; });
+    });
+    std::cout << "speedup: " << serialTransform / parallelTransform << "x\n";
+
+    std::unique_ptr<TAS::Array<float, floatCount>> weights(new TAS::Array<float, floatCount>(0.25f));
+    double scalarSum = benchmark("sum, scalar loop", sizeof(*floats), 10, [&]() {
+        float sum{};
+        for (size_t i = 0; i < floatCount; i++) sum += (*floats)[i];
+        doNotOptimize(sum);
+    });
+    double simdSum = benchmark("sum", sizeof(*floats), 10, [&]() {
+        doNotOptimize(floats->sum());
+    });
+    std::cout << "speedup: " << scalarSum / simdSum << "x\n";
+    benchmark("min", sizeof(*floats), 10, [&]() {
+        doNotOptimize(floats->min());
+    });
+    benchmark("dot", 2 * sizeof(*floats), 10, [&]() {
+        doNotOptimize(floats->dot(*weights));
+    });
+    benchmark("count", sizeof(*floats), 10, [&]() {
+        doNotOptimize(floats->count(1.5f));
+    });
+    benchmark("scale", 2 * sizeof(*floats), 10, [&]() {
+        floats->scale(0.999f);
+    });
+    benchmark("add", 3 * sizeof(*floats), 10, [&]() {
+        floats->add(*weights);
+    });
+    benchmark("fma", 4 * sizeof(*floats), 10, [&]() {
+        floats->fma(*weights, *weights);
+    });
+
+    constexpr size_t sortCount = 1 << 22;
+    std::mt19937 sortRandom(7);
+    std::unique_ptr<TAS::Array<int32_t, sortCount>> unsorted(new TAS::Array<int32_t, sortCount>());
+    unsorted->transformReference([&sortRandom](int32_t &x) { x = static_cast<int32_t>(sortRandom()); });
+    std::unique_ptr<TAS::Array<int32_t, sortCount>> sorting(new TAS::Array<int32_t, sortCount>());
+    double stdSort = benchmark("std::sort, 1 << 22 int32_t", sizeof(*unsorted), 5, [&]() {
+        *sorting = *unsorted;
+        std::sort(sorting->data(), sorting->data() + sortCount);
+    });
+    double vectorSort = benchmark("sort, 1 << 22 int32_t", sizeof(*unsorted), 5, [&]() {
+        *sorting = *unsorted;
+        sorting->sort();
+    });
+    std::cout << "speedup: " << stdSort / vectorSort << "x\n";
+
+    constexpr size_t smallCount = 1 << 16;
+    std::vector<TAS::Array<float, 16>> smallUnsorted(smallCount), smallSorting(smallCount);
+    for (TAS::Array<float, 16> &small : smallUnsorted) {
+        small.transformReference([&sortRandom](float &x) { x = static_cast<float>(sortRandom() % 1000); });
+    }
+    stdSort = benchmark("std::sort, 1 << 16 x 16 floats", smallCount * sizeof(smallUnsorted[0]), 5, [&]() {
+        smallSorting = smallUnsorted;
+        for (TAS::Array<float, 16> &small : smallSorting) std::sort(small.data(), small.data() + 16);
+    });
+    double networkSort = benchmark("sort, 1 << 16 x 16 floats", smallCount * sizeof(smallUnsorted[0]), 5, [&]() {
+        smallSorting = smallUnsorted;
+        for (TAS::Array<float, 16> &small : smallSorting) small.sort();
+    });
+    std::cout << "speedup: " << stdSort / networkSort << "x\n";
+
+    constexpr size_t tableCount = 1 << 20;
+    constexpr size_t queryCount = 1 << 20;
+    std::unique_ptr<TAS::Array<uint64_t, tableCount>> table(new TAS::Array<uint64_t, tableCount>());
+    table->transformReferenceWithIndex([](uint64_t &x, size_t i) { x = 3 * i; });
+    std::unique_ptr<TAS::EytzingerArray<uint64_t, tableCount>> eytzinger(new TAS::EytzingerArray<uint64_t, tableCount>(*table));
+    std::vector<uint64_t> queries(queryCount);
+    for (uint64_t &query : queries) query = sortRandom() % (3 * tableCount);
+    double stdLowerBound = benchmark("std::lower_bound, 1M uint64_t", queryCount * sizeof(uint64_t), 5, [&]() {
+        size_t found{};
+        for (uint64_t query : queries) found += std::lower_bound(table->data(), table->data() + tableCount, query) - table->data();
+        doNotOptimize(found);
+    });
+    double branchless = benchmark("lowerBound, 1M uint64_t", queryCount * sizeof(uint64_t), 5, [&]() {
+        size_t found{};
+        for (uint64_t query : queries) found += table->lowerBound(query);
+        doNotOptimize(found);
+    });
+    double eytzingerSearch = benchmark("EytzingerArray::lowerBound, 1M uint64_t", queryCount * sizeof(uint64_t), 5, [&]() {
+        size_t found{};
+        for (uint64_t query : queries) found += eytzinger->lowerBound(query);
+        doNotOptimize(found);
+    });
+    std::cout << "speedup: " << stdLowerBound / branchless << "x, " << stdLowerBound / eytzingerSearch << "x\n";
+
+    constexpr size_t bodyCount = 1 << 20;
+    std::unique_ptr<TAS::Array<Body, bodyCount>> bodies(new TAS::Array<Body, bodyCount>());
+    bodies->transformReferenceWithIndex([](Body &b, size_t i) { b.mass = static_cast<float>(i % 7); b.x = 1.0f; });
+    typedef TAS::SoAArray<Body, bodyCount, &Body::x, &Body::y, &Body::z, &Body::vx, &Body::vy, &Body::vz, &Body::mass, &Body::charge> Bodies;
+    std::unique_ptr<Bodies> bodyColumns(new Bodies(*bodies));
+    double structMass = benchmark("mass sum, Array of 1 << 20 structs", bodyCount * sizeof(float), 10, [&]() {
+        float massSum{};
+        bodies->forEach([&massSum](Body const &b) { massSum += b.mass; });
+        doNotOptimize(massSum);
+    });
+    double columnMass = benchmark("mass sum, SoAArray column", bodyCount * sizeof(float), 10, [&]() {
+        doNotOptimize(bodyColumns->field<&Body::mass>().sum());
+    });
+    std::cout << "speedup: " << structMass / columnMass << "x\n";
+
+    constexpr size_t scratchCount = 1 << 25;
+    std::unique_ptr<TAS::Array<float, scratchCount>> plainScratch(new TAS::Array<float, scratchCount>());
+    std::unique_ptr<TAS::AlignedArray<float, scratchCount>> alignedScratch(new TAS::AlignedArray<float, scratchCount>(TAS::uninitialized));
+    double cachedFill = benchmark("Array::fill, 128 MB", sizeof(*plainScratch), 10, [&]() {
+        plainScratch->fill(0.25f);
+        doNotOptimize(plainScratch->data());
+    });
+    double streamingFill = benchmark("AlignedArray::fill, 128 MB, non-temporal", sizeof(*alignedScratch), 10, [&]() {
+        alignedScratch->fill(0.25f);
+        doNotOptimize(alignedScratch->data());
+    });
+    std::cout << "speedup: " << cachedFill / streamingFill << "x\n";
+
+    constexpr size_t byteCount = 1 << 24;
+    std::unique_ptr<TAS::Array<uint8_t, byteCount>> bytes(new TAS::Array<uint8_t, byteCount>(7));
+    std::unique_ptr<TAS::Array<uint8_t, byteCount>> sameBytes(new TAS::Array<uint8_t, byteCount>(7));
+    double scalarFind = benchmark("std::find, 16 MB uint8_t", byteCount, 10, [&]() {
+        doNotOptimize(std::find(bytes->data(), bytes->data() + byteCount, 9));
+    });
+    double vectorFind = benchmark("indexOf, 16 MB uint8_t", byteCount, 10, [&]() {
+        doNotOptimize(bytes->indexOf(9));
+    });
+    benchmark("count, 16 MB uint8_t", byteCount, 10, [&]() {
+        doNotOptimize(bytes->count(7));
+    });
+    benchmark("operator==, 16 MB uint8_t", 2 * byteCount, 10, [&]() {
+        doNotOptimize(*bytes == *sameBytes);
+    });
+    std::cout << "speedup: " << scalarFind / vectorFind << "x\n";
+    // TAS::Array Benchmarks
+
+    // TAS::BitArray Benchmarks
+    BENCH_INIT(TAS::BitArray)
+    constexpr size_t rowCount = 1 << 26;
+    std::mt19937_64 rowRng(11);
+    TAS::BitVector firstFilter(rowCount);
+    TAS::BitVector secondFilter(rowCount);
+    std::vector<bool> boolFilter(rowCount);
+    for (size_t i = 0; i < firstFilter.wordCount(); i++)
+    {
+        firstFilter.words()[i] = rowRng();
+        secondFilter.words()[i] = rowRng();
+    }
+    for (size_t i = 0; i < rowCount; i++) boolFilter[i] = firstFilter[i];
+    benchmark("std::vector<bool> count 1 << 26 bits", rowCount / 8, 5, [&]() {
+        doNotOptimize(std::count(boolFilter.begin(), boolFilter.end(), true));
+    });
+    benchmark("Scalar popcount of 1 << 26 bits", rowCount / 8, 5, [&]() {
+        size_t setRows{};
+        for (size_t i = 0; i < firstFilter.wordCount(); i++) setRows += __builtin_popcountll(firstFilter.words()[i]);
+        doNotOptimize(setRows);
+    });
+    benchmark("BitVector::count 1 << 26 bits", rowCount / 8, 5, [&]() {
+        doNotOptimize(firstFilter.count());
+    });
+    TAS::BitVector combinedFilter = firstFilter;
+    benchmark("BitVector &= and count 1 << 26 bits", rowCount / 8 * 2, 5, [&]() {
+        combinedFilter &= secondFilter;
+        doNotOptimize(combinedFilter.count());
+    });
+
+    constexpr size_t rankQueries = 1 << 20;
+    TAS::RankSelect filterIndex(firstFilter);
+    std::vector<size_t> queryRows(rankQueries);
+    for (size_t &row : queryRows) row = rowRng() % rowCount;
+    benchmark("RankSelect::rank 1 << 20 random rows", 0, 5, [&]() {
+        size_t ranks{};
+        for (size_t row : queryRows) ranks += filterIndex.rank(row);
+        doNotOptimize(ranks);
+    });
+    benchmark("RankSelect::select 1 << 20 random ranks", 0, 5, [&]() {
+        size_t rows{};
+        for (size_t row : queryRows) rows += filterIndex.select(row % filterIndex.count());
+        doNotOptimize(rows);
+    });
+    // TAS::BitArray Benchmarks
+
+    // TAS::Vector Benchmarks
+    BENCH_INIT(TAS::Vector)
+    constexpr size_t pushCount = 1 << 22;
+    double stdPush = benchmark("std::vector::push_back, 1 << 22 int32_t", pushCount * sizeof(int32_t), 10, [&]() {
+        std::vector<int32_t> pushed;
+        for (size_t i = 0; i < pushCount; i++) pushed.push_back(static_cast<int32_t>(i));
+        doNotOptimize(pushed.data());
+    });
+    double tasPush = benchmark("Vector::pushBack, 1 << 22 int32_t", pushCount * sizeof(int32_t), 10, [&]() {
+        TAS::Vector<int32_t> pushed;
+        for (size_t i = 0; i < pushCount; i++) pushed.pushBack(static_cast<int32_t>(i));
+        doNotOptimize(pushed.data());
+    });
+    std::cout << "speedup: " << stdPush / tasPush << "x\n";
+
+    constexpr size_t emplaceCount = 1 << 20;
+    double stdEmplace = benchmark("std::vector::emplace_back, 1 << 20 std::string", emplaceCount * sizeof(std::string), 5, [&]() {
+        std::vector<std::string> emplaced;
+        for (size_t i = 0; i < emplaceCount; i++) emplaced.emplace_back(8, 'x');
+        doNotOptimize(emplaced.data());
+    });
+    double tasEmplace = benchmark("Vector::emplaceBack, 1 << 20 std::string", emplaceCount * sizeof(std::string), 5, [&]() {
+        TAS::Vector<std::string> emplaced;
+        for (size_t i = 0; i < emplaceCount; i++) emplaced.emplaceBack(8, 'x');
+        doNotOptimize(emplaced.data());
+    });
+    std::cout << "speedup: " << stdEmplace / tasEmplace << "x\n";
+
+    constexpr size_t listCount = 1 << 20;
+    double heapLists = benchmark("Vector, 1 << 20 lists of 6 int32_t", listCount * 6 * sizeof(int32_t), 5, [&]() {
+        int64_t listSum{};
+        for (size_t i = 0; i < listCount; i++)
+        {
+            TAS::Vector<int32_t> list;
+            for (int32_t j = 0; j < 6; j++) list.pushBack(j);
+            listSum += list.back();
+        }
+        doNotOptimize(listSum);
+    });
+    double inlineLists = benchmark("SmallVector<int32_t, 8>, 1 << 20 lists of 6 int32_t", listCount * 6 * sizeof(int32_t), 5, [&]() {
+        int64_t listSum{};
+        for (size_t i = 0; i < listCount; i++)
+        {
+            TAS::SmallVector<int32_t, 8> list;
+            for (int32_t j = 0; j < 6; j++) list.pushBack(j);
+            listSum += list.back();
+        }
+        doNotOptimize(listSum);
+    });
+    std::cout << "speedup: " << heapLists / inlineLists << "x\n";
+    // TAS::Vector Benchmarks
+
+    // TAS::MdArray Benchmarks
+    BENCH_INIT(TAS::MdArray)
+    constexpr size_t gridSide = 4096;
+    typedef TAS::MdArray<float, gridSide, gridSide> Grid;
+    std::unique_ptr<Grid> grid(new Grid(TAS::uninitialized));
+    std::unique_ptr<Grid> gridTransposed(new Grid(TAS::uninitialized));
+    grid->transformReferenceWithIndex([](float &x, TAS::Array<size_t, 2> const &i) { x = static_cast<float>(i[0]) - i[1]; });
+    double naiveTranspose = benchmark("naive transpose, 4096 x 4096 floats", 2 * sizeof(*grid), 5, [&]() {
+        float const *from = grid->data();
+        float *to = gridTransposed->data();
+        for (size_t i = 0; i < gridSide; i++)
+        {
+            for (size_t j = 0; j < gridSide; j++) to[j * gridSide + i] = from[i * gridSide + j];
+        }
+        doNotOptimize(to);
+    });
+    double blockedTranspose = benchmark("transpose, 4096 x 4096 floats", 2 * sizeof(*grid), 5, [&]() {
+        TAS::transpose(grid->view(), gridTransposed->view());
+        doNotOptimize(gridTransposed->data());
+    });
+    std::cout << "speedup: " << naiveTranspose / blockedTranspose << "x\n";
+    // TAS::MdArray Benchmarks
+
+    // TAS::SpscRing Benchmarks
+    BENCH_INIT(TAS::SpscRing)
+    constexpr uint64_t itemCount = 1 << 24;
+    std::unique_ptr<TAS::SpscRing<uint64_t, 4096>> itemRing(new TAS::SpscRing<uint64_t, 4096>());
+    double roundTrip = benchmark("SpscRing tryPush + tryPop on one thread, 1 << 24 uint64_t", itemCount * sizeof(uint64_t), 3, [&]() {
+        uint64_t checksum{};
+        uint64_t item{};
+        for (uint64_t i = 0; i < itemCount; i++)
+        {
+            itemRing->tryPush(i);
+            itemRing->tryPop(item);
+            checksum += item;
+        }
+        doNotOptimize(checksum);
+    });
+    double batchRoundTrip = benchmark("SpscRing pushN + popN by 64 on one thread, 1 << 24 uint64_t", itemCount * sizeof(uint64_t), 3, [&]() {
+        uint64_t checksum{};
+        uint64_t batch[64];
+        for (uint64_t i = 0; i < itemCount; i += 64)
+        {
+            for (uint64_t j = 0; j < 64; j++) batch[j] = i + j;
+            itemRing->pushN(batch, 64);
+            itemRing->popN(batch, 64);
+            checksum += batch[63];
+        }
+        doNotOptimize(checksum);
+    });
+    std::cout << "Mops/s: " << itemCount / roundTrip / 1e6 << ", " << itemCount / batchRoundTrip / 1e6 << "\n";
+
+    // a producer and a consumer only run concurrently with at least two hardware threads
+    if(std::thread::hardware_concurrency() >= 2) {
+        std::queue<uint64_t> lockedQueue;
+        std::mutex queueMutex;
+        double lockedTime = benchmark("std::queue + std::mutex, two threads, 1 << 24 uint64_t", itemCount * sizeof(uint64_t), 3, [&]() {
+            std::thread producer([&]() {
+                for (uint64_t i = 0; i < itemCount; i++) {
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                    lockedQueue.push(i);
+                }
+            });
+            uint64_t checksum{};
+            for (uint64_t received = 0; received < itemCount;) {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                if(lockedQueue.empty()) continue;
+                checksum += lockedQueue.front();
+                lockedQueue.pop();
+                received++;
+            }
+            producer.join();
+            doNotOptimize(checksum);
+        });
+        double singleTime = benchmark("SpscRing tryPush/tryPop, two threads, 1 << 24 uint64_t", itemCount * sizeof(uint64_t), 3, [&]() {
+            std::thread producer([&]() {
+                for (uint64_t i = 0; i < itemCount;) i += itemRing->tryPush(i);
+            });
+            uint64_t checksum{};
+            uint64_t item;
+            for (uint64_t received = 0; received < itemCount;) {
+                if(itemRing->tryPop(item)) {
+                    checksum += item;
+                    received++;
+                }
+            }
+            producer.join();
+            doNotOptimize(checksum);
+        });
+        double batchTime = benchmark("SpscRing pushN/popN by 64, two threads, 1 << 24 uint64_t", itemCount * sizeof(uint64_t), 3, [&]() {
+            std::thread producer([&]() {
+                uint64_t batch[64];
+                for (uint64_t i = 0; i < itemCount;) {
+                    for (uint64_t j = 0; j < 64; j++) batch[j] = i + j;
+                    i += itemRing->pushN(batch, itemCount - i < 64 ? itemCount - i : 64);
+                }
+            });
+            uint64_t checksum{};
+            uint64_t batch[64];
+            for (uint64_t received = 0; received < itemCount;) {
+                size_t n = itemRing->popN(batch, 64);
+                for (size_t j = 0; j < n; j++) checksum += batch[j];
+                received += n;
+            }
+            producer.join();
+            doNotOptimize(checksum);
+        });
+        std::cout << "Mops/s: " << itemCount / lockedTime / 1e6 << ", " << itemCount / singleTime / 1e6 << ", " << itemCount / batchTime / 1e6 << "\n";
+    }
+    // TAS::SpscRing Benchmarks
+
+    // TAS::MpmcQueue Benchmarks
+    BENCH_INIT(TAS::MpmcQueue)
+    constexpr uint64_t contendedCount = 1 << 20;
+    constexpr size_t queueCapacity = 1024;
+    TAS::MpmcQueue<uint64_t> contendedQueue(queueCapacity);
+    std::queue<uint64_t> boundedQueue;
+    std::mutex boundedMutex;
+    // threads / 2 producers hand contendedCount items to threads / 2 consumers, one thread pushes and pops in turn
+    for (size_t threads = 1; threads <= 64; threads *= 2)
+    {
+        size_t sides = threads < 2 ? 1 : threads / 2;
+        uint64_t perSide = contendedCount / sides;
+        auto run = [&](auto &&produce, auto &&consume) {
+            if(threads == 1) {
+                uint64_t checksum{};
+                for (uint64_t i = 0; i < contendedCount; i++) {
+                    produce(i);
+                    checksum += consume();
+                }
+                doNotOptimize(checksum);
+                return;
+            }
+            std::vector<std::thread> sideThreads;
+            for (size_t t = 0; t < sides; t++)
+            {
+                sideThreads.emplace_back([&]() {
+                    for (uint64_t i = 0; i < perSide; i++) produce(i);
+                });
+                sideThreads.emplace_back([&]() {
+                    uint64_t checksum{};
+                    for (uint64_t i = 0; i < perSide; i++) checksum += consume();
+                    doNotOptimize(checksum);
+                });
+            }
+            for (std::thread &sideThread : sideThreads) sideThread.join();
+        };
+        std::string lockedName = "bounded std::queue + std::mutex, " + std::to_string(threads) + " threads, 1 << 20 uint64_t";
+        double lockedTime = benchmark(lockedName.c_str(), contendedCount * sizeof(uint64_t), 3, [&]() {
+            run([&](uint64_t i) {
+                while(true) {
+                    {
+                        std::lock_guard<std::mutex> lock(boundedMutex);
+                        if(boundedQueue.size() < queueCapacity) {
+                            boundedQueue.push(i);
+                            return;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            }, [&]() {
+                while(true) {
+                    {
+                        std::lock_guard<std::mutex> lock(boundedMutex);
+                        if(!boundedQueue.empty()) {
+                            uint64_t item = boundedQueue.front();
+                            boundedQueue.pop();
+                            return item;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            });
+        });
+        std::string queueName = "MpmcQueue push/pop, " + std::to_string(threads) + " threads, 1 << 20 uint64_t";
+        double queueTime = benchmark(queueName.c_str(), contendedCount * sizeof(uint64_t), 3, [&]() {
+            run([&](uint64_t i) {
+                contendedQueue.push(i);
+            }, [&]() {
+                return contendedQueue.pop();
+            });
+        });
+        std::cout << "Mops/s: " << contendedCount / lockedTime / 1e6 << ", " << contendedCount / queueTime / 1e6 << "\n";
+    }
+    // TAS::MpmcQueue Benchmarks
+
+    // TAS::String Benchmarks
+    BENCH_INIT(TAS::String)
+    TAS::String hay('a', size_t(1) << 30);
+    for (size_t i = 0; i < hay.size(); i += 4096) {
+        hay[i] = 'n';
+        hay[i + 1] = 'e';
+    }
+
+    double serial = benchmark("findAll", hay.size(), 3, [&]() {
+        doNotOptimize(hay.findAll("needle").size());
+    });
+    for (size_t threads = 1; threads <= 32; threads *= 2) {
+        std::cout << threads << " threads, ";
+        double parallel = benchmark("parallelFindAll", hay.size(), 3, [&]() {
+            doNotOptimize(hay.parallelFindAll("needle", threads).size());
+        });
+        std::cout << "speedup: " << serial / parallel << "x\n";
+    }
+
+    std::mt19937 rng(42);
+    std::vector<TAS::String> words;
+    for (size_t i = 0; i < 20000; i++) {
+        TAS::String word('a', 4 + rng() % 12);
+        for (size_t j = 0; j < word.size(); j++) word[j] = 'a' + rng() % 26;
+        words.push_back(word);
+    }
+    TAS::String query("algorithmic");
+    double textbook = benchmark("textbook Levenshtein, dictionary", 0, 3, [&]() {
+        size_t close{};
+        for (TAS::String const &word : words) close += textbookLevenshtein(query, word) <= 2;
+        doNotOptimize(close);
+    });
+    double myers = benchmark("levenshteinDistance, dictionary", 0, 3, [&]() {
+        size_t close{};
+        for (TAS::String const &word : words) close += query.levenshteinDistance(word) <= 2;
+        doNotOptimize(close);
+    });
+    double bounded = benchmark("boundedLevenshteinDistance(k = 2), dictionary", 0, 3, [&]() {
+        size_t close{};
+        for (TAS::String const &word : words) close += query.boundedLevenshteinDistance(word, 2) <= 2;
+        doNotOptimize(close);
+    });
+    std::cout << "speedup: " << textbook / myers << "x, bounded: " << textbook / bounded << "x\n";
+
+    TAS::String longA('a', 2000), longB('a', 2000);
+    for (size_t j = 0; j < longA.size(); j++) {
+        longA[j] = 'a' + rng() % 4;
+        longB[j] = 'a' + rng() % 4;
+    }
+    textbook = benchmark("textbook Levenshtein, 2000 x 2000", 0, 3, [&]() {
+        doNotOptimize(textbookLevenshtein(longA, longB));
+    });
+    myers = benchmark("levenshteinDistance, 2000 x 2000", 0, 3, [&]() {
+        doNotOptimize(longA.levenshteinDistance(longB));
+    });
+    std::cout << "speedup: " << textbook / myers << "x\n";
+
+    std::vector<TAS::String> sortStrings;
+    for (size_t i = 0; i < 1000000; i++) {
+        TAS::String str("https://example.com/");
+        for (size_t j = rng() % 24; j > 0; j--) str.append('a' + rng() % 26);
+        sortStrings.push_back(str);
+    }
+    std::vector<TAS::StringRef> sortRefs(sortStrings.begin(), sortStrings.end());
+    std::vector<TAS::StringRef> sorted;
+    double comparison = benchmark("std::sort, 1M StringRef", 0, 3, [&]() {
+        sorted = sortRefs;
+        std::sort(sorted.begin(), sorted.end());
+    });
+    double radix = benchmark("stringSort, 1M StringRef", 0, 3, [&]() {
+        sorted = sortRefs;
+        TAS::stringSort(sorted.data(), sorted.data() + sorted.size());
+    });
+    std::cout << "speedup: " << comparison / radix << "x\n";
+
+    TAS::String logText('x', 1 << 28);
+    for (size_t i = 0; i < logText.size(); i += 40 + rng() % 80) logText[i] = '\n';
+    TAS::LineIndex logIndex;
+    benchmark("LineIndex build", logText.size(), 3, [&]() {
+        logIndex = TAS::LineIndex(logText);
+    });
+    benchmark("1M lineOf lookups", 0, 3, [&]() {
+        size_t sum{};
+        for (size_t i = 0; i < 1000000; i++) sum += logIndex.lineOf((i * 2654435761u) % logText.size());
+        doNotOptimize(sum);
+    });
+    // TAS::String Benchmarks
+
+    // TAS::Pipeline Benchmarks
+    BENCH_INIT(TAS::Pipeline)
+    constexpr size_t stageCount = 1 << 22;
+    typedef TAS::Array<float, stageCount> Samples;
+    std::unique_ptr<Samples> samples(new Samples());
+    std::unique_ptr<Samples> stagedSamples(new Samples());
+    std::mt19937 sampleRng(5);
+    std::uniform_real_distribution<float> sampleDist(-1.0f, 1.0f);
+    samples->transformReference([&](float &x) { x = sampleDist(sampleRng); });
+    benchmark("transformAndCopy + forEach, 1 << 22 floats", stageCount * sizeof(float), 5, [&]() {
+        *stagedSamples = *samples;
+        stagedSamples->transformAndCopy([](float x) { return x * 1.5f + 0.25f; });
+        float res{};
+        stagedSamples->forEach([&res](float x) { if(x > 0) res += x; });
+        doNotOptimize(res);
+    });
+    benchmark("view().map().filter().sum(), 1 << 22 floats", stageCount * sizeof(float), 5, [&]() {
+        doNotOptimize(samples->view().map([](float x) { return x * 1.5f + 0.25f; }).filter([](float x) { return x > 0; }).sum());
+    });
+    benchmark("Handwritten loop, 1 << 22 floats", stageCount * sizeof(float), 5, [&]() {
+        float res{};
+        for (size_t i = 0; i < stageCount; i++)
+        {
+            float x = (*samples)[i] * 1.5f + 0.25f;
+            if(x > 0) res += x;
+        }
+        doNotOptimize(res);
+    });
+
+    TAS::String digitText('x', 1 << 24);
+    for (size_t i = 0; i < digitText.size(); i += 7) digitText[i] = static_cast<char>('0' + i % 10);
+    benchmark("String view().filter().map().sum(), 1 << 24 chars", digitText.size(), 5, [&]() {
+        doNotOptimize(digitText.view().filter([](char c) { return c >= '0' && c <= '9'; }).map([](char c) { return static_cast<size_t>(c - '0'); }).sum());
+    });
+    // TAS::Pipeline Benchmarks
+
+    // TAS::StringTable Benchmarks
+    BENCH_INIT(TAS::StringTable)
+    constexpr size_t nameCount = 1 << 20;
+    typedef TAS::Array<TAS::String, nameCount> NameArray;
+    std::unique_ptr<NameArray> nameArray;
+    TAS::StringTable nameTable;
+    char shortName[6] = "aaaaa";
+    benchmark("Array<String> fill with 1 << 20 5-char strings", 0, 3, [&]() {
+        nameArray.reset(new NameArray());
+        for (size_t i = 0; i < nameCount; i++)
+        {
+            shortName[i % 5] = static_cast<char>('a' + i % 26);
+            (*nameArray)[i] = shortName;
+        }
+        doNotOptimize(nameArray->back().size());
+    });
+    benchmark("StringTable append 1 << 20 5-char strings", 0, 3, [&]() {
+        nameTable.clear();
+        for (size_t i = 0; i < nameCount; i++)
+        {
+            shortName[i % 5] = static_cast<char>('a' + i % 26);
+            nameTable.append(TAS::StringRef(shortName, 5));
+        }
+        doNotOptimize(nameTable.size());
+    });
+    size_t arrayBytes = sizeof(NameArray);
+    nameArray->forEach([&arrayBytes](TAS::String const &name) { arrayBytes += name.capacity(); });
+    std::cout << "Bytes: Array<String> " << arrayBytes << " + allocator overhead, StringTable " << nameTable.serializedSize() << "\n";
+    benchmark("Array<String> sum of first characters", 0, 5, [&]() {
+        size_t res{};
+        nameArray->forEach([&res](TAS::String const &name) { res += static_cast<unsigned char>(name[0]); });
+        doNotOptimize(res);
+    });
+    benchmark("StringTable sum of first characters", 0, 5, [&]() {
+        size_t res{};
+        nameTable.forEach([&res](TAS::StringRef name) { res += static_cast<unsigned char>(name[0]); });
+        doNotOptimize(res);
+    });
+    // TAS::StringTable Benchmarks
+
+    // TAS::HashMap Benchmarks
+    BENCH_INIT(TAS::HashMap)
+    constexpr size_t keyCount = 1 << 20;
+    std::vector<std::string> keyStrings(keyCount);
+    std::vector<uint64_t> keyNumbers(keyCount);
+    std::mt19937_64 keyRng(7);
+    for (size_t i = 0; i < keyCount; i++)
+    {
+        keyNumbers[i] = keyRng();
+        keyStrings[i] = "user/" + std::to_string(keyNumbers[i]);
+    }
+    // lookups in insertion order would favour node based maps, whose nodes are allocated in that order
+    std::vector<size_t> lookupOrder(keyCount);
+    for (size_t i = 0; i < keyCount; i++) lookupOrder[i] = i;
+    std::shuffle(lookupOrder.begin(), lookupOrder.end(), keyRng);
+    std::unordered_map<std::string, uint64_t> stdStringMap;
+    TAS::HashMap<TAS::String, uint64_t> tasStringMap;
+    benchmark("std::unordered_map<std::string> insert 1 << 20 keys", 0, 3, [&]() {
+        std::unordered_map<std::string, uint64_t>().swap(stdStringMap);
+        stdStringMap.reserve(keyCount);
+        for (size_t i = 0; i < keyCount; i++) stdStringMap.emplace(keyStrings[i], i);
+        doNotOptimize(stdStringMap.size());
+    });
+    benchmark("TAS::HashMap<TAS::String> insert 1 << 20 keys", 0, 3, [&]() {
+        TAS::HashMap<TAS::String, uint64_t>().swap(tasStringMap);
+        tasStringMap.reserve(keyCount);
+        for (size_t i = 0; i < keyCount; i++) tasStringMap.insert(TAS::StringRef(keyStrings[i].data(), keyStrings[i].size()), i);
+        doNotOptimize(tasStringMap.size());
+    });
+    benchmark("std::unordered_map<std::string> find by std::string", 0, 3, [&]() {
+        uint64_t found{};
+        for (size_t i : lookupOrder) found += stdStringMap.find(keyStrings[i])->second;
+        doNotOptimize(found);
+    });
+    benchmark("std::unordered_map<std::string> find by const char *", 0, 3, [&]() {
+        uint64_t found{};
+        for (size_t i : lookupOrder) found += stdStringMap.find(keyStrings[i].c_str())->second;
+        doNotOptimize(found);
+    });
+    benchmark("TAS::HashMap<TAS::String> find by const char *", 0, 3, [&]() {
+        uint64_t found{};
+        for (size_t i : lookupOrder) found += tasStringMap.find(keyStrings[i].c_str())->value;
+        doNotOptimize(found);
+    });
+    benchmark("TAS::HashMap<TAS::String> find by StringRef", 0, 3, [&]() {
+        uint64_t found{};
+        for (size_t i : lookupOrder) found += tasStringMap.find(TAS::StringRef(keyStrings[i].data(), keyStrings[i].size()))->value;
+        doNotOptimize(found);
+    });
+
+    std::unordered_map<uint64_t, uint64_t> stdNumberMap;
+    TAS::HashMap<uint64_t, uint64_t> tasNumberMap;
+    benchmark("std::unordered_map<uint64_t> insert 1 << 20 keys", 0, 3, [&]() {
+        std::unordered_map<uint64_t, uint64_t>().swap(stdNumberMap);
+        for (size_t i = 0; i < keyCount; i++) stdNumberMap.emplace(keyNumbers[i], i);
+        doNotOptimize(stdNumberMap.size());
+    });
+    benchmark("TAS::HashMap<uint64_t> insert 1 << 20 keys", 0, 3, [&]() {
+        TAS::HashMap<uint64_t, uint64_t>().swap(tasNumberMap);
+        for (size_t i = 0; i < keyCount; i++) tasNumberMap.insert(keyNumbers[i], i);
+        doNotOptimize(tasNumberMap.size());
+    });
+    benchmark("std::unordered_map<uint64_t> find, half misses", 0, 3, [&]() {
+        uint64_t found{};
+        for (size_t i : lookupOrder) found += stdNumberMap.count(keyNumbers[i] + (i & 1));
+        doNotOptimize(found);
+    });
+    benchmark("TAS::HashMap<uint64_t> find, half misses", 0, 3, [&]() {
+        uint64_t found{};
+        for (size_t i : lookupOrder) found += tasNumberMap.contains(keyNumbers[i] + (i & 1));
+        doNotOptimize(found);
+    });
+    // TAS::HashMap Benchmarks
+
+    // TAS Encoding Benchmarks
+    BENCH_INIT(TAS Encoding)
+    TAS::String payload('\0', 1 << 24);
+    for (size_t i = 0; i < payload.size(); i++) payload[i] = static_cast<char>(rng());
+    TAS::String encoded, decoded;
+    benchmark("encodeBase64", payload.size(), 5, [&]() {
+        encoded.resize(0);
+        TAS::encodeBase64(payload, encoded);
+    });
+    benchmark("decodeBase64", encoded.size(), 5, [&]() {
+        decoded.resize(0);
+        TAS::decodeBase64(encoded, decoded);
+    });
+    benchmark("encodeHex", payload.size(), 5, [&]() {
+        encoded.resize(0);
+        TAS::encodeHex(payload, encoded);
+    });
+    benchmark("decodeHex", encoded.size(), 5, [&]() {
+        decoded.resize(0);
+        TAS::decodeHex(encoded, decoded);
+    });
+
+    TAS::String text('a', 1 << 24);
+    for (size_t i = 0; i < text.size(); i++) text[i] = (rng() % 6) ? 'a' + rng() % 26 : ' ';
+    for (size_t i = 0; i < text.size(); i += 200) text[i] = '"';
+    benchmark("escapeJson char by char", text.size(), 5, [&]() {
+        encoded.resize(0);
+        TAS::EscapeTable const &table = TAS::jsonEscapeTable();
+        for (size_t i = 0; i < text.size(); i++) {
+            char const *escape = table[static_cast<unsigned char>(text[i])];
+            if(escape) encoded.append(escape, TAS::cStringLength(escape));
+            else encoded.append(&text[i], 1);
+        }
+    });
+    benchmark("escapeJson", text.size(), 5, [&]() {
+        encoded.resize(0);
+        TAS::escapeJson(text, encoded);
+    });
+    benchmark("unescapeJson", encoded.size(), 5, [&]() {
+        decoded.resize(0);
+        TAS::unescapeJson(encoded, decoded);
+    });
+    // TAS Encoding Benchmarks
+}
+
+int main() {
+    Bench();
+    return 0;
+}
@@ -1,9 +1,59 @@
 #include <Test.hpp>
 
+#include <AlignedArray.hpp>
 #include <Any.hpp>
 #include <Array.hpp>
+#include <BitArray.hpp>
+#include <Encoding.hpp>
+#include <EytzingerArray.hpp>
+#include <HashMap.hpp>
+#include <Json.hpp>
+#include <LineIndex.hpp>
+#include <MdArray.hpp>
+#include <MpmcQueue.hpp>
+#include <Pipeline.hpp>
+#include <SmallVector.hpp>
+#include <SoAArray.hpp>
+#include <SpscRing.hpp>
 #include <String.hpp>
+#include <StringSort.hpp>
+#include <StringTable.hpp>
+#include <ThreadPool.hpp>
 #include <Tuple.hpp>
+#include <Vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __cplusplus >= 202002L
+static_assert(std::contiguous_iterator<TAS::ArrayIterator<int>>);
+static_assert(std::contiguous_iterator<TAS::ConstArrayIterator<int>>);
+static_assert(std::random_access_iterator<TAS::ReverseArrayIterator<int>>);
+static_assert(std::random_access_iterator<TAS::ConstReverseArrayIterator<int>>);
+static_assert(std::contiguous_iterator<TAS::StringIterator<char>>);
+static_assert(std::contiguous_iterator<TAS::ConstStringIterator<char>>);
+static_assert(std::random_access_iterator<TAS::ReverseStringIterator<char>>);
+static_assert(std::random_access_iterator<TAS::ConstReverseStringIterator<char>>);
+#endif
+
+struct Particle {
+    float x, y;
+    int id;
+};
+
+struct Quad {
+    uint64_t a, b, c, d;
+};
+
+struct QuadPair {
+    Quad first, second;
+};
 
 //TODO: OMG... all... ALL the Tests for ALL lib
 
@@ -32,8 +82,547 @@ void Test() {
     ASSERT_EQ(arr[1], 3)
     ASSERT_EQ(arr[2], 4)
     ASSERT_EQ(arr[3], 5)
+
+    int sum{};
+    arr.forEach([&sum](int const &val) { sum += val; });
+    ASSERT_EQ(sum, 14)
+    arr.transformAndCopyWithIndex([](int const &val, size_t i) { return val * static_cast<int>(i); });
+    ASSERT(arr == (TAS::Array<int, 4>{0, 3, 8, 15}))
+    std::function<void(int &)> increment = [](int &val) { val++; };
+    arr.transformReference(increment);
+    ASSERT(arr == (TAS::Array<int, 4>{1, 4, 9, 16}))
+
+    std::unique_ptr<TAS::Array<int, 1 << 20>> large(new TAS::Array<int, 1 << 20>(1));
+    TAS::parallelTransformAndCopy(*large, [](int const &val) { return val + 2; }, 1000);
+    std::atomic<long> largeSum{0};
+    TAS::parallelForEach(*large, [&largeSum](int const &val) { largeSum += val; });
+    ASSERT_EQ(largeSum, 3 << 20)
+
+    TAS::ThreadPool pool(3);
+    std::atomic<size_t> covered{0};
+    pool.parallelFor(0, 1000, 7, [&covered](size_t first, size_t last) { covered += last - first; });
+    ASSERT_EQ(covered, 1000)
+
+    TAS::Array<float, 37> ramp;
+    ramp.transformAndCopyWithIndex([](float const &, size_t i) { return static_cast<float>(i); });
+    ASSERT_EQ(ramp.sum(), 666.0f)
+    ASSERT_EQ(ramp.min(), 0.0f)
+    ASSERT_EQ(ramp.max(), 36.0f)
+    ASSERT_EQ(ramp.dot(TAS::Array<float, 37>(2.0f)), 1332.0f)
+    ramp.scale(2.0f).add(TAS::Array<float, 37>(1.0f)).fma(TAS::Array<float, 37>(3.0f), TAS::Array<float, 37>(-3.0f));
+    ASSERT_EQ(ramp[10], 60.0f)
+    ASSERT_EQ(ramp.count(6.0f * 5), 1)
+    ASSERT_EQ(large->sum(), 3 << 20)
+    std::unique_ptr<TAS::Array<float, 1 << 24>> ones(new TAS::Array<float, 1 << 24>(1.0f));
+    ASSERT_EQ(ones->sum(), static_cast<float>(1 << 24))
+
+    TAS::Array<int, 7> small{5, -1, 3, 3, 9, 0, 2};
+    ASSERT(small.sort() == (TAS::Array<int, 7>{-1, 0, 2, 3, 3, 5, 9}))
+    ASSERT(small.sort([](int a, int b) { return a > b; }).isSorted([](int a, int b) { return a > b; }))
+    large->transformAndCopyWithIndex([](int const &, size_t i) { return static_cast<int>((i * 2654435761u) % 1000); });
+    ASSERT(!large->isSorted())
+    ASSERT(large->sort().isSorted())
+    std::unique_ptr<TAS::Array<float, 461>> withNan(new TAS::Array<float, 461>());
+    withNan->transformAndCopyWithIndex([](float const &, size_t i) {
+        return i % 50 == 7 ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>((i * 2654435761u) % 1000);
+    });
+    withNan->sort();
+    ASSERT(std::is_sorted(withNan->begin(), withNan->begin() + 451))
+    ASSERT(std::all_of(withNan->begin() + 451, withNan->end(), [](float x) { return x != x; }))
+    TAS::Array<double, 8> smallNan{3.0, std::numeric_limits<double>::quiet_NaN(), 1.0, 4.0, 1.0, 5.0, 9.0, 2.0};
+    smallNan.sort();
+    ASSERT(std::is_sorted(smallNan.begin(), smallNan.begin() + 7) && smallNan[7] != smallNan[7])
+    std::reverse(withNan->begin(), withNan->end());
+    withNan->partialSort(460);
+    ASSERT(std::is_sorted(withNan->begin(), withNan->begin() + 451) && (*withNan)[460] != (*withNan)[460])
+    TAS::Array<std::string, 6> names{"f", "d", "e", "b", "a", "c"};
+    names.partialSort(3);
+    ASSERT_EQ(names[0], "a")
+    ASSERT_EQ(names[2], "c")
+
+    ASSERT_EQ(small.sort().lowerBound(3), 3)
+    ASSERT_EQ(small.upperBound(3), 5)
+    ASSERT(small.binarySearch(9) && !small.binarySearch(4))
+    TAS::EytzingerArray<int, 7> eytzinger(small);
+    ASSERT_EQ(eytzinger.lowerBound(3), 3)
+    ASSERT_EQ(eytzinger.upperBound(3), 5)
+    ASSERT_EQ(eytzinger.lowerBound(10), 7)
+    ASSERT(eytzinger.contains(-1) && !eytzinger.contains(1))
+
+    constexpr TAS::Array<uint32_t, 256> crcTable = []() {
+        TAS::Array<uint32_t, 256> table;
+        table.transformAndCopyWithIndex([](uint32_t const &, size_t i) {
+            uint32_t crc = static_cast<uint32_t>(i);
+            for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320u : 0);
+            return crc;
+        });
+        return table;
+    }();
+    static_assert(crcTable[1] == 0x77073096u, "CRC table is computed at compile time");
+    ASSERT_EQ(crcTable.at(255), 0x2D02EF8Du)
+    constexpr TAS::Array<int, 3> digits{1, 2, 3};
+    static_assert(*digits.crbegin() == 3 && *(digits.cbegin() + 1) == 2 && digits.contains(2), "Array is usable in constant expressions");
+    ASSERT(*(digits.crend() - 1) == 1)
+
+    TAS::Array<int, 5> shuffled{4, 1, 3, 0, 2};
+    std::sort(shuffled.begin(), shuffled.end());
+    ASSERT(shuffled == (TAS::Array<int, 5>{0, 1, 2, 3, 4}))
+    std::sort(shuffled.rbegin(), shuffled.rend());
+    ASSERT(shuffled == (TAS::Array<int, 5>{4, 3, 2, 1, 0}))
+    ASSERT_EQ(shuffled.end() - shuffled.begin(), 5)
+    ASSERT_EQ((2 + shuffled.cbegin())[1], 1)
+    ASSERT_EQ(shuffled.crbegin()[1], 1)
+
+    TAS::AlignedArray<float, 100> aligned(2.0f);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned.data()) % 64, 0u)
+    ASSERT_EQ(aligned.sum(), 200.0f)
+    std::unique_ptr<TAS::AlignedArray<int32_t, (1 << 24), 4096>> scratch(new TAS::AlignedArray<int32_t, (1 << 24), 4096>(TAS::uninitialized));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(scratch->data()) % 4096, 0u)
+    scratch->fill(-7);
+    ASSERT(scratch->front() == -7 && scratch->back() == -7 && scratch->count(-7) == scratch->size())
+    int32_t streamed[19]{};
+    TAS::simdStreamFill(streamed + 1, 17, 5);
+    ASSERT(streamed[0] == 0 && streamed[1] == 5 && streamed[17] == 5 && streamed[18] == 0)
+    std::unique_ptr<TAS::AlignedArray<Quad, (33 << 20) / sizeof(Quad)>> quads(new TAS::AlignedArray<Quad, (33 << 20) / sizeof(Quad)>(TAS::uninitialized));
+    quads->fill(Quad{1, 2, 3, 4});
+    ASSERT(std::all_of(quads->begin(), quads->end(), [](Quad const &q) { return q.a == 1 && q.b == 2 && q.c == 3 && q.d == 4; }))
+    alignas(64) QuadPair quadPairs[5];
+    TAS::simdStreamFill(quadPairs, 5, QuadPair{{1, 2, 3, 4}, {5, 6, 7, 8}});
+    ASSERT(quadPairs[0].first.a == 1 && quadPairs[0].second.a == 5 && quadPairs[4].first.d == 4 && quadPairs[4].second.d == 8)
+
+    TAS::Array<uint16_t, 77> codes;
+    codes.transformReferenceWithIndex([](uint16_t &x, size_t i) { x = static_cast<uint16_t>(i % 10); });
+    ASSERT_EQ(codes.indexOf(9), 9u)
+    ASSERT_EQ(codes.indexOf(10), 77u)
+    ASSERT_EQ(codes.count(6), 8u)
+    TAS::Array<uint16_t, 77> otherCodes = codes;
+    ASSERT(codes == otherCodes)
+    otherCodes[76] = 1;
+    ASSERT(codes != otherCodes)
+    ASSERT(!otherCodes.contains(6 + 10))
+    static_assert(digits.indexOf(3) == 2, "indexOf is usable in constant expressions");
     TEST_END
     // TAS::Array Tests
+
+    // TAS::BitArray Tests
+    TEST_INIT(TAS::BitArray)
+    TAS::BitArray<130> evenBits;
+    for (size_t i = 0; i < 130; i += 2) evenBits.set(i);
+    TAS::BitArray<130> lowBits;
+    for (size_t i = 0; i < 70; i++) lowBits.set(i);
+    ASSERT(evenBits.count() == 65 && (~evenBits).count() == 65 && TAS::BitArray<130>(true).all())
+    ASSERT((evenBits & lowBits).count() == 35 && (evenBits | lowBits).count() == 100 && (evenBits ^ lowBits).count() == 65)
+    ASSERT(TAS::BitArray<130>(evenBits).andNot(lowBits).findFirstSet() == 70 && lowBits.findNextSet(69) == 130)
+    size_t setIndexSum{};
+    lowBits.forEachSet([&setIndexSum](size_t index) { setIndexSum += index; });
+    ASSERT_EQ(setIndexSum, 69u * 70u / 2u)
+
+    TAS::BitVector rowMask(1000);
+    for (size_t i = 0; i < 1000; i += 3) rowMask.set(i);
+    rowMask.pushBack(true).resize(1003, true);
+    ASSERT(rowMask.size() == 1003 && rowMask.count() == 337 && rowMask.findNextSet(999) == 1000)
+    ASSERT_THROWS(rowMask &= TAS::BitVector(64), std::invalid_argument)
+
+    TAS::RankSelect rowIndex(rowMask);
+    ASSERT(rowIndex.count() == 337 && rowIndex.rank(0) == 0 && rowIndex.rank(4) == 2 && rowIndex.rank(1003) == 337)
+    ASSERT(rowIndex.select(0) == 0 && rowIndex.select(100) == 300 && rowIndex.select(336) == 1002)
+    TEST_END
+    // TAS::BitArray Tests
+
+    // TAS::Vector Tests
+    TEST_INIT(TAS::Vector)
+    TAS::Vector<int> ints;
+    for (int i = 0; i < 100; i++) ints.pushBack(i);
+    ASSERT_EQ(ints.size(), 100u)
+    ASSERT(ints.capacity() >= 100 && ints.capacity() < 200)
+    ASSERT_EQ(ints.back(), 99)
+    ints.pushBack(ints[0]);
+    ASSERT_EQ(ints.back(), 0)
+    ints.popBack().transformReferenceWithIndex([](int &x, size_t i) { x = static_cast<int>(i) * 2; });
+    ASSERT_EQ(ints.at(50), 100)
+    ASSERT_THROWS(ints.at(100), std::out_of_range)
+    ASSERT(std::is_sorted(ints.begin(), ints.end()))
+    ASSERT_EQ(*ints.rbegin(), 198)
+    ints.append(ints.data(), ints.size());
+    ASSERT(ints.size() == 200 && ints[150] == 100 && ints.back() == 198)
+
+    TAS::Vector<std::string> letters{"b", "a"};
+    std::string &added = letters.emplaceBack(3, 'c');
+    ASSERT_EQ(added, "ccc")
+    for (int i = 0; i < 20; i++) letters.emplaceBack(letters[0]);
+    ASSERT_EQ(letters.size(), 23u)
+    ASSERT_EQ(letters[22], "b")
+    TAS::Vector<std::string> stolen(std::move(letters));
+    ASSERT(letters.empty())
+    letters = stolen;
+    ASSERT(letters == stolen)
+    letters.resize(2).shrinkToFit();
+    ASSERT(letters == (TAS::Vector<std::string>{"b", "a"}))
+    ASSERT_EQ(letters.capacity(), 2u)
+    letters.resize(10, letters[0]);
+    ASSERT(letters.size() == 10 && letters[1] == "a" && letters[2] == "b" && letters[9] == "b")
+
+    std::shared_ptr<int> counted = std::make_shared<int>(1);
+    {
+        TAS::Vector<std::shared_ptr<int>> owners(10, counted);
+        owners.reserve(1000);
+        ASSERT_EQ(counted.use_count(), 11)
+    }
+    ASSERT_EQ(counted.use_count(), 1)
+    TEST_END
+    // TAS::Vector Tests
+
+    // TAS::SmallVector Tests
+    TEST_INIT(TAS::SmallVector)
+    TAS::SmallVector<int, 4> few{3, 1, 2};
+    few.pushBack(0);
+    ASSERT(few.inlined())
+    std::sort(few.begin(), few.end());
+    ASSERT(few == (TAS::SmallVector<int, 4>{0, 1, 2, 3}))
+    few.pushBack(few[3]);
+    ASSERT(!few.inlined())
+    ASSERT_EQ(few.back(), 3)
+    ASSERT_EQ(few.size(), 5u)
+    few.popBack().shrinkToFit();
+    ASSERT(few.inlined())
+    ASSERT_EQ(*few.crbegin(), 3)
+
+    TAS::SmallVector<std::string, 2> spilled{"inline"};
+    TAS::SmallVector<std::string, 2> tokens(std::move(spilled));
+    ASSERT(spilled.empty())
+    ASSERT_EQ(tokens[0], "inline")
+    for (int i = 0; i < 10; i++) tokens.emplaceBack(tokens[0]);
+    spilled = tokens;
+    ASSERT(spilled == tokens)
+    tokens = std::move(spilled);
+    ASSERT(spilled.empty() && spilled.inlined())
+    ASSERT_EQ(tokens.size(), 11u)
+    tokens.resize(1).shrinkToFit();
+    ASSERT(tokens.inlined())
+    tokens.resize(12, tokens[0]);
+    ASSERT(tokens.size() == 12 && tokens[1] == "inline" && tokens[11] == "inline")
+    TEST_END
+    // TAS::SmallVector Tests
+
+    // TAS::SoAArray Tests
+    TEST_INIT(TAS::SoAArray)
+    TAS::Array<Particle, 20> particles;
+    particles.transformReferenceWithIndex([](Particle &p, size_t i) { p = {float(i), 2.0f * i, int(i)}; });
+    TAS::SoAArray<Particle, 20, &Particle::x, &Particle::y> columns(particles);
+    ASSERT_EQ(columns.field<&Particle::x>().sum(), 190.0f)
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(columns.column<1>().data()) % 64, 0u)
+    columns.field<&Particle::y>().scale(0.5f);
+    columns.transformReference([](auto p) { p.template field<&Particle::x>() += 1.0f; });
+    columns[3] = Particle{7.0f, 8.0f, 9};
+    Particle third = columns.at(3);
+    ASSERT(third.x == 7.0f && third.y == 8.0f && third.id == 0)
+    columns.store(particles);
+    ASSERT(particles[5].x == 6.0f && particles[5].y == 5.0f && particles[3].id == 3)
+    float ySum{};
+    columns.forEach([&ySum](auto p) { ySum += p.template get<1>(); });
+    ASSERT_EQ(ySum, 195.0f)
+    TEST_END
+    // TAS::SoAArray Tests
+
+    // TAS::MdArray Tests
+    TEST_INIT(TAS::MdArray)
+    TAS::MdArray<int, 3, 4> grid;
+    grid.transformReferenceWithIndex([](int &x, TAS::Array<size_t, 2> const &i) { x = static_cast<int>(10 * i[0] + i[1]); });
+    ASSERT(grid(2, 3) == 23 && grid.at(1, 2) == 12 && grid.flat()[5] == 11)
+    TAS::MdArray<int, 4, 3> flipped = grid.transposed();
+    ASSERT(flipped(3, 2) == 23 && flipped(0, 1) == 10)
+    TAS::MdView<int, 2> gridView = grid.view();
+    TAS::MdView<int, 2> oddColumns = gridView.slice(1, 1, 4, 2);
+    ASSERT(oddColumns.extent(1) == 2 && oddColumns(2, 1) == 23)
+    ASSERT_EQ(gridView.subView(1, 2)(2), 22)
+    ASSERT_EQ(gridView.transposed()(3, 2), 23)
+    TAS::MdView<int, 2> columnMajor(grid.data(), TAS::Array<size_t, 2>{4, 3}, TAS::Layout::ColumnMajor);
+    ASSERT_EQ(columnMajor(3, 2), 23)
+    int tiles{};
+    grid.forEachTile(2, [&tiles](TAS::MdView<int, 2> tile, size_t row, size_t column) {
+        tiles += tile(0, 0) == static_cast<int>(10 * row + column);
+    });
+    ASSERT_EQ(tiles, 4)
+    TEST_END
+    // TAS::MdArray Tests
+
+    // TAS::SpscRing Tests
+    TEST_INIT(TAS::SpscRing)
+    TAS::SpscRing<std::string, 4> letterRing;
+    ASSERT(letterRing.tryPush("a") && letterRing.tryEmplace(2, 'b') && letterRing.tryPush("c") && letterRing.tryPush("d"))
+    ASSERT(!letterRing.tryPush("e"))
+    std::string popped;
+    ASSERT(letterRing.tryPop(popped) && popped == "a")
+    ASSERT(letterRing.tryPush("e"))
+    std::string drained[8];
+    ASSERT_EQ(letterRing.popN(drained, 8), 4u)
+    ASSERT(drained[0] == "bb" && drained[3] == "e" && letterRing.empty())
+
+    constexpr uint32_t transferCount = 1 << 20;
+    std::unique_ptr<TAS::SpscRing<uint32_t, 1024>> ring(new TAS::SpscRing<uint32_t, 1024>());
+    std::thread producer([&ring]() {
+        uint32_t batch[37];
+        for (uint32_t next = 0; next < transferCount;) {
+            if(next % 3 == 0) {
+                if(ring->tryPush(next)) next++;
+                continue;
+            }
+            uint32_t n = transferCount - next < 37 ? transferCount - next : 37;
+            for (uint32_t i = 0; i < n; i++) batch[i] = next + i;
+            next += static_cast<uint32_t>(ring->pushN(batch, n));
+        }
+    });
+    bool ordered = true;
+    uint32_t nextExpected{};
+    uint32_t received[64];
+    while(nextExpected < transferCount) {
+        size_t n = ring->popN(received, 64);
+        for (size_t i = 0; i < n; i++) ordered &= received[i] == nextExpected++;
+        uint32_t single;
+        if(ring->tryPop(single)) ordered &= single == nextExpected++;
+    }
+    producer.join();
+    ASSERT(ordered)
+    ASSERT(ring->empty())
+    TEST_END
+    // TAS::SpscRing Tests
+
+    // TAS::MpmcQueue Tests
+    TEST_INIT(TAS::MpmcQueue)
+    ASSERT_THROWS(TAS::MpmcQueue<int>(6), std::invalid_argument)
+
+    TAS::MpmcQueue<std::unique_ptr<int>> ownerQueue(2);
+    ASSERT(ownerQueue.tryPush(std::make_unique<int>(1)) && ownerQueue.tryEmplace(new int(2)))
+    std::unique_ptr<int> rejected = std::make_unique<int>(3);
+    ASSERT(!ownerQueue.tryPush(std::move(rejected)) && rejected && ownerQueue.size() == 2)
+    std::unique_ptr<int> owned;
+    ASSERT(ownerQueue.tryPop(owned) && *owned == 1)
+    ASSERT(*ownerQueue.pop() == 2 && !ownerQueue.tryPop(owned) && ownerQueue.empty())
+    ownerQueue.push(std::move(rejected));
+
+    constexpr uint64_t perProducer = 1 << 16;
+    constexpr size_t sideThreads = 4;
+    TAS::MpmcQueue<uint64_t> sharedQueue(256);
+    std::atomic<uint64_t> consumedSum{0};
+    std::atomic<uint64_t> consumedCount{0};
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < sideThreads; t++)
+    {
+        workers.emplace_back([&sharedQueue, t]() {
+            for (uint64_t i = 0; i < perProducer; i++) {
+                if(i % 2) sharedQueue.push(t * perProducer + i);
+                else while(!sharedQueue.tryPush(t * perProducer + i)) std::this_thread::yield();
+            }
+        });
+        workers.emplace_back([&]() {
+            uint64_t sum{};
+            uint64_t item;
+            for (uint64_t i = 0; i < perProducer; i++) {
+                if(i % 2) sum += sharedQueue.pop();
+                else {
+                    while(!sharedQueue.tryPop(item)) std::this_thread::yield();
+                    sum += item;
+                }
+            }
+            consumedSum += sum;
+            consumedCount += perProducer;
+        });
+    }
+    for (std::thread &worker : workers) worker.join();
+    uint64_t produced = sideThreads * perProducer;
+    ASSERT_EQ(consumedCount.load(), produced)
+    ASSERT_EQ(consumedSum.load(), produced * (produced - 1) / 2)
+    ASSERT(sharedQueue.empty())
+    TEST_END
+    // TAS::MpmcQueue Tests
+
+    // TAS::String Tests
+    TEST_INIT(TAS::String)
+    TAS::String hay("abababa");
+    ASSERT(hay.findAll("aba") == std::vector<size_t>({0, 2, 4}))
+    ASSERT(hay.findAll("c").empty())
+    ASSERT(hay.findAll("abababab").empty())
+    TAS::String reversed("stressed");
+    std::reverse(reversed.begin(), reversed.end());
+    ASSERT(reversed == TAS::String("desserts"))
+    ASSERT_EQ(reversed.cend() - reversed.cbegin(), 8)
+    ASSERT(TAS::String(std::string(reversed.crbegin(), reversed.crend()).c_str()) == TAS::String("stressed"))
+    ASSERT(*(reversed.crend() - 1) == 'd' && TAS::ConstStringIterator<char>(reversed.crbegin()) == reversed.cend() - 1)
+    ASSERT(reversed.span(3, 0) == TAS::String("sed"))
+
+    TAS::String big('x', 4 << 20);
+    big[0] = 'n'; big[1] = 'e';
+    big[(1 << 20) - 1] = 'n'; big[1 << 20] = 'e';
+    big[big.size() - 2] = 'n'; big[big.size() - 1] = 'e';
+    std::vector<size_t> expected{0, (1 << 20) - 1, big.size() - 2};
+    ASSERT(big.parallelFindAll("ne", 4) == expected)
+    ASSERT(big.parallelFindAll("ne", 4) == big.findAll("ne"))
+
+    ASSERT_EQ(TAS::String("kitten").levenshteinDistance("sitting"), 3)
+    ASSERT_EQ(TAS::String("").levenshteinDistance("abc"), 3)
+    ASSERT_EQ(TAS::String("kitten").boundedLevenshteinDistance("sitting", 2), 3)
+    ASSERT_EQ(TAS::String('a', 100).levenshteinDistance(TAS::String('b', 70)), 100)
+    ASSERT_EQ(TAS::String("the quick brown fox").fuzzyFindFirst("quikc", 2), 4)
+    ASSERT_EQ(TAS::String("the quick brown fox").fuzzyFindFirst("slow", 1), TAS::String::nPos)
+
+    TAS::Array<TAS::String, 5> words{"pear", "apple", "applesauce", "", "app"};
+    TAS::stringSort(words);
+    ASSERT(words == (TAS::Array<TAS::String, 5>{"", "app", "apple", "applesauce", "pear"}))
+    TAS::StringRef refs[3]{"b", "ab", "a"};
+    TAS::stringSort(refs, refs + 3);
+    ASSERT(refs[0] == "a" && refs[1] == "ab" && refs[2] == "b")
+    std::vector<std::string> prefixed;
+    for (size_t i = 0; i < 300; i++) prefixed.push_back("shared/prefix/" + std::string(i % 7, '\0') + std::string(i % 3, static_cast<char>('a' + i % 5)));
+    std::vector<TAS::StringRef> prefixedRefs;
+    for (std::string const &str : prefixed) prefixedRefs.emplace_back(str.data(), str.size());
+    TAS::stringSort(prefixedRefs.data(), prefixedRefs.data() + prefixedRefs.size());
+    std::vector<std::string> prefixedExpected = prefixed;
+    std::sort(prefixedExpected.begin(), prefixedExpected.end());
+    bool prefixedSorted = true;
+    for (size_t i = 0; i < prefixed.size(); i++) prefixedSorted &= prefixedRefs[i] == TAS::StringRef(prefixedExpected[i].data(), prefixedExpected[i].size());
+    ASSERT(prefixedSorted)
+
+    TAS::String log("first\nsecond\n");
+    TAS::LineIndex lines(log);
+    ASSERT_EQ(lines.lineCount(), 3)
+    ASSERT_EQ(lines.lineOffset(1), 6)
+    ASSERT_EQ(lines.lineLength(1), 6)
+    ASSERT_EQ(lines.lineOf(8), 1)
+    log.append(TAS::String("third\nfourth"));
+    lines.update(log);
+    ASSERT_EQ(lines.lineCount(), 4)
+    ASSERT_EQ(lines.lineOffset(3), 19)
+    ASSERT_EQ(lines.lineOf(log.size()), 3)
+    TEST_END
+    // TAS::String Tests
+
+    // TAS::Pipeline Tests
+    TEST_INIT(TAS::Pipeline)
+    TAS::Array<int, 8> pipelineInput{1, 2, 3, 4, 5, 6, 7, 8};
+    ASSERT_EQ(pipelineInput.view().map([](int x) { return x * x; }).filter([](int x) { return x % 2 == 0; }).sum(), 120)
+    ASSERT_EQ(pipelineInput.view().reduce(1, [](int acc, int x) { return acc * x; }), 40320)
+    size_t stagesCalled{};
+    TAS::Vector<double> halves;
+    pipelineInput.view().map([&stagesCalled](int x) { stagesCalled++; return x / 2.0; }).filter([](double x) { return x > 1; }).take(2).collect(halves);
+    ASSERT(halves.size() == 2 && halves[0] == 1.5 && halves[1] == 2.0 && stagesCalled == 4)
+    ASSERT(!pipelineInput.view().filter([](int x) { return x > 8; }).any())
+
+    TAS::String pipelineText("a1b22c333");
+    ASSERT_EQ(pipelineText.view().filter([](char c) { return c >= '0' && c <= '9'; }).map([](char c) { return c - '0'; }).sum(), 14)
+    ASSERT_EQ(TAS::StringRef(pipelineText).view().take(3).count(), 3u)
+    TEST_END
+    // TAS::Pipeline Tests
+
+    // TAS::StringTable Tests
+    TEST_INIT(TAS::StringTable)
+    TAS::StringTable cityTable{"Oslo", "", "Lima"};
+    char const cityLine[] = "Rome,Kyiv";
+    ASSERT_EQ(cityTable.append(TAS::StringRef(cityLine + 5, 4)), 3u)
+    ASSERT(cityTable.size() == 4 && cityTable.charCount() == 12 && cityTable[1].empty())
+    ASSERT(cityTable[3] == TAS::StringRef("Kyiv") && cityTable.indexOf("Lima") == 2 && !cityTable.contains("Rome"))
+    ASSERT_THROWS(cityTable.at(4), std::out_of_range)
+    TAS::StringTable echoTable{"echo"};
+    for (int i = 0; i < 6; i++) echoTable.append(echoTable[echoTable.size() - 1]);
+    ASSERT(echoTable.size() == 7 && echoTable.charCount() == 28 && echoTable[6] == TAS::StringRef("echo"))
+
+    TAS::Vector<unsigned char> cityBytes = cityTable.serialize();
+    ASSERT_EQ(cityBytes.size(), cityTable.serializedSize())
+    TAS::StringTableView mappedCities = TAS::StringTableView::fromBytes(cityBytes.data(), cityBytes.size());
+    size_t cityChars{};
+    mappedCities.forEach([&cityChars](TAS::StringRef city) { cityChars += city.size(); });
+    ASSERT(mappedCities.size() == 4 && cityChars == 12 && mappedCities.at(0) == TAS::StringRef("Oslo"))
+    ASSERT_THROWS(TAS::StringTableView::fromBytes(cityBytes.data(), cityBytes.size() - 1), std::invalid_argument)
+    TAS::Vector<unsigned char> corruptBytes = cityBytes;
+    uint64_t corruptOffset = 1000;
+    memcpy(corruptBytes.data() + sizeof(TAS::StringTableHeader) + 2 * sizeof(uint64_t), &corruptOffset, sizeof(corruptOffset));
+    ASSERT_THROWS(TAS::StringTableView::fromBytes(corruptBytes.data(), corruptBytes.size()), std::invalid_argument)
+    corruptBytes = cityBytes;
+    corruptOffset = 2;
+    memcpy(corruptBytes.data() + sizeof(TAS::StringTableHeader) + 3 * sizeof(uint64_t), &corruptOffset, sizeof(corruptOffset));
+    ASSERT_THROWS(TAS::StringTableView::fromBytes(corruptBytes.data(), corruptBytes.size()), std::invalid_argument)
+    TEST_END
+    // TAS::StringTable Tests
+
+    // TAS::HashMap Tests
+    TEST_INIT(TAS::HashMap)
+    TAS::HashMap<TAS::String, int> wordCounts;
+    for (char const *word : {"red", "green", "red", "blue", "red", "green"}) wordCounts[word]++;
+    ASSERT_EQ(wordCounts.size(), 3u)
+    ASSERT(wordCounts.at("red") == 3 && wordCounts.at(TAS::String("green")) == 2)
+    char const line[] = "blue sky";
+    ASSERT(wordCounts.find(TAS::StringRef(line, 4))->value == 1 && !wordCounts.contains(TAS::StringRef(line, 3)))
+    ASSERT_THROWS(wordCounts.at("violet"), std::out_of_range)
+    ASSERT(!wordCounts.insert("red", 10).second && wordCounts.insertOrAssign("red", 10).first->value == 10)
+    ASSERT(wordCounts.erase("green") && !wordCounts.erase("green") && wordCounts.size() == 2)
+    int countSum{};
+    for (auto const &[word, wordCount] : wordCounts) countSum += wordCount;
+    ASSERT_EQ(countSum, 11)
+
+    TAS::HashMap<uint64_t, uint64_t> squares;
+    squares.reserve(1000);
+    size_t reservedCapacity = squares.capacity();
+    for (uint64_t i = 0; i < 1000; i++) squares.insert(i, i * i);
+    ASSERT(squares.capacity() == reservedCapacity && squares.at(999) == 998001u)
+    for (uint64_t i = 0; i < 1000; i += 2) squares.erase(i);
+    TAS::HashMap<uint64_t, uint64_t> squaresCopy = squares;
+    squares.rehash(0);
+    ASSERT(squares.capacity() < reservedCapacity && squares == squaresCopy && !squares.contains(500) && squares.at(501) == 251001u)
+
+    TAS::HashMap<int, TAS::String> copies;
+    copies.insert(0, TAS::String('c', 100));
+    for (int i = 1; i < 200; i++) copies.insert(i, copies.at(0));
+    bool copiesIntact = copies.size() == 200;
+    for (auto const &[copyKey, copy] : copies) copiesIntact = copiesIntact && copy == TAS::String('c', 100);
+    ASSERT(copiesIntact)
+    TAS::HashMap<TAS::String, int> prefixes;
+    prefixes.insert(TAS::String('p', 64), 64);
+    for (int i = 63; i > 0; i--) prefixes.insert(TAS::StringRef(prefixes.find(TAS::String('p', i + 1))->key.cString(), i), i);
+    ASSERT(prefixes.size() == 64 && prefixes.at(TAS::String('p', 1)) == 1 && prefixes.at(TAS::String('p', 40)) == 40)
+    TEST_END
+    // TAS::HashMap Tests
+
+    // TAS Encoding Tests
+    TEST_INIT(TAS Encoding)
+    TAS::String encoded;
+    TAS::encodeBase64(TAS::String("Many hands make light work."), encoded);
+    ASSERT(encoded == "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu")
+    TAS::String decoded;
+    TAS::decodeBase64(encoded, decoded);
+    ASSERT(decoded == "Many hands make light work.")
+    ASSERT_THROWS(TAS::decodeBase64(TAS::String("TWE=TWFu"), decoded), std::invalid_argument)
+    ASSERT(decoded == "Many hands make light work.")
+
+    TAS::String hex;
+    TAS::encodeHex(TAS::String("\x01\xAB\xff"), hex);
+    ASSERT(hex == "01abff")
+    TAS::String bytes;
+    TAS::decodeHex(TAS::String("01ABff"), bytes);
+    ASSERT(bytes == "\x01\xAB\xff")
+    TAS::String selfEncoded('x', 40);
+    TAS::String expectedEncoded('x', 40);
+    TAS::encodeBase64(TAS::String('x', 40), expectedEncoded);
+    TAS::encodeBase64(selfEncoded.cString(), selfEncoded.size(), selfEncoded);
+    ASSERT(selfEncoded == expectedEncoded)
+    TAS::String selfHex('7', 64);
+    TAS::decodeHex(selfHex.cString(), selfHex.size(), selfHex);
+    ASSERT(selfHex.size() == 96 && selfHex[95] == 'w')
+
+    TAS::String json("\"");
+    TAS::escapeJson(TAS::String("say \"hi\"\n\\ \x01"), json);
+    ASSERT(json == "\"say \\\"hi\\\"\\n\\\\ \\u0001")
+    TAS::String unescaped;
+    TAS::unescapeJson(TAS::String("say \\\"hi\\\"\\n \\u00e9"), unescaped);
+    ASSERT(unescaped == "say \"hi\"\n \xc3\xa9")
+    TAS::String selfEscaped('"', 40);
+    TAS::escapeJson(selfEscaped.cString(), selfEscaped.size(), selfEscaped);
+    ASSERT(selfEscaped.size() == 120 && selfEscaped[40] == '\\' && selfEscaped[119] == '"')
+    TAS::String selfUnescaped('a', 30);
+    selfUnescaped.append(TAS::String("\\u00e9"));
+    TAS::unescapeJson(selfUnescaped.cString(), selfUnescaped.size(), selfUnescaped);
+    ASSERT(selfUnescaped.size() == 68 && selfUnescaped[66] == '\xc3')
+    ASSERT_THROWS(TAS::unescapeJson(TAS::String("bad \\q"), unescaped), std::invalid_argument)
+    TEST_END
+    // TAS Encoding Tests
 }
 
 int main() {
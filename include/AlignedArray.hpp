@@ -0,0 +1,107 @@
+/**
+ * @file AlignedArray.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the AlignedArray class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <Simd.hpp>
+
+#include <initializer_list>
+#include <type_traits>
+
+/**
+ * @brief AlignedArray::fill uses non-temporal stores for arrays of at least this many bytes,
+ * it should be above the size of the last level cache
+ * 
+ */
+#ifndef TAS_STREAM_FILL_THRESHOLD
+#define TAS_STREAM_FILL_THRESHOLD (1 << 25)
+#endif
+
+namespace TAS
+{
+
+/**
+ * @brief Array whose first element is aligned to Alignment bytes, 64 puts it on a cache line
+ * and makes full vector loads aligned, 4096 puts it on a page.
+ * It is an Array, so it can be passed wherever an Array of the same type and size is expected
+ * 
+ * @tparam T type
+ * @tparam Size size
+ * @tparam Alignment power of two not less than alignof(T)
+ */
+template<typename T, size_t Size, size_t Alignment = 64>
+class alignas(Alignment) AlignedArray : public Array<T, Size> {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+        "Alignment must be a power of two not less than alignof(T)");
+
+    AlignedArray(T const &val, std::true_type) : Array<T, Size>(uninitialized) {
+        fill(val);
+    }
+
+    AlignedArray(T const &val, std::false_type) {
+        fill(val);
+    }
+
+public:
+    /**
+     * @brief Construct a new Aligned Array object with value initialized elements
+     * 
+     */
+    constexpr AlignedArray() = default;
+
+    /**
+     * @brief Construct a new Aligned Array object without initializing the elements
+     * 
+     */
+    explicit AlignedArray(Uninitialized) : Array<T, Size>(uninitialized) {}
+
+    /**
+     * @brief Construct a new Aligned Array object by filling it with val, large arrays are filled with streaming stores
+     * 
+     * @param val
+     */
+    AlignedArray(T const &val) : AlignedArray(val, std::is_trivially_default_constructible<T>{}) {}
+
+    /**
+     * @brief Construct a new Aligned Array object from std::initalizer_list
+     * if val has not Size elements throws std::out_of_range
+     * 
+     * @param val
+     */
+    constexpr AlignedArray(std::initializer_list<T> const &val) : Array<T, Size>(val) {}
+
+    /**
+     * @brief alignment of the first element in bytes
+     * 
+     */
+    static constexpr size_t alignment() {
+        return Alignment;
+    }
+
+    /**
+     * @brief Fills array with value of type T. Arrays of TAS_STREAM_FILL_THRESHOLD bytes or more bypass
+     * the cache with non-temporal stores, so filling a scratch buffer does not evict the working set
+     * and does not read the old contents from memory
+     * 
+     * @param val
+     */
+    AlignedArray &fill(T const &val) {
+        if constexpr (std::is_trivially_copyable<T>::value && sizeof(T) * Size >= TAS_STREAM_FILL_THRESHOLD) {
+            simdStreamFill(this->data(), Size, val);
+        } else {
+            Array<T, Size>::fill(val);
+        }
+        return *this;
+    }
+};
+
+} // namespace TAS
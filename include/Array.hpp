@@ -11,13 +11,17 @@
 
 #pragma once
 
+#include <Pipeline.hpp>
 #include <Print.hpp>
+#include <Search.hpp>
+#include <Simd.hpp>
+#include <Sort.hpp>
 
+#include <stdint.h>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
-#include <functional>
-
-//TODO: change std::function with TAS::Function
+#include <type_traits>
 
 namespace TAS
 {
@@ -36,6 +40,13 @@ template<typename T>
 class ConstReverseArrayIterator;
 //Forwards
 
+/**
+ * @brief tag for constructors that leave trivial elements uninitialized, for storage that is overwritten right away
+ * 
+ */
+struct Uninitialized {};
+inline constexpr Uninitialized uninitialized{};
+
 /**
  * @brief constant sized Array of orbitrary type
  * 
@@ -44,28 +55,45 @@ class ConstReverseArrayIterator;
  */
 template<typename T, size_t Size>
 class Array {
-    T m_data[Size]{};
+    T m_data[Size];
 
 public:
     /**
      * @brief Construct a new Array object from std::initalizer_list
+     * if val has not Size elements throws std::out_of_range, in constant expressions this is a compile error
      * 
      * @param val 
      */
-    Array(std::initializer_list<T>const &val) {
+    constexpr Array(std::initializer_list<T>const &val) : m_data{} {
         if(val.size() != Size) throw std::out_of_range("Miscount of arguments");
-        std::copy(val.begin(), val.begin() + Size, m_data);
+        for (size_t i = 0; i < Size; i++)
+        {
+            m_data[i] = val.begin()[i];
+        }
     }
 
-    Array() = default;
+    /**
+     * @brief Construct a new Array object with value initialized elements, zeroes for arithmetic T
+     * 
+     */
+    constexpr Array() : m_data{} {}
     ~Array() = default;
 
+    /**
+     * @brief Construct a new Array object without initializing the elements.
+     * Skips zeroing of large buffers that are filled afterwards anyway
+     * 
+     */
+    explicit Array(Uninitialized) {
+        static_assert(std::is_trivially_default_constructible<T>::value, "only trivial elements can be left uninitialized");
+    }
+
     /**
      * @brief Construct a new Array object by filling it with val
      * 
      * @param val 
      */
-    Array(T const &val) {
+    constexpr Array(T const &val) : m_data{} {
         fill(val);
     }
 
@@ -74,10 +102,10 @@ public:
      * 
      * @param val 
      */
-    Array &fill(T const &val) {
-        for (ArrayIterator<T> i = begin(); i < end(); i++)
+    constexpr Array &fill(T const &val) {
+        for (size_t i = 0; i < Size; i++)
         {
-            *i = val;
+            m_data[i] = val;
         }
         return *this;
     }
@@ -88,7 +116,7 @@ public:
      * @param index 
      * @return T& 
      */
-    T &at(size_t index) {
+    constexpr T &at(size_t index) {
         if(index >= Size) throw std::out_of_range("Index is out of range");
         return m_data[index];
     }
@@ -99,7 +127,7 @@ public:
      * @param index 
      * @return T& 
      */
-    const T &at(size_t index) const {
+    constexpr const T &at(size_t index) const {
         if(index >= Size) throw std::out_of_range("Index is out of range");
         return m_data[index];
     }
@@ -110,7 +138,7 @@ public:
      * @param index 
      * @return T& 
      */
-    T &operator[](size_t index) {
+    constexpr T &operator[](size_t index) {
         return m_data[index];
     }
 
@@ -120,7 +148,7 @@ public:
      * @param index 
      * @return T& 
      */
-    const T &operator[](size_t index) const {
+    constexpr const T &operator[](size_t index) const {
         return m_data[index];
     }
     
@@ -129,79 +157,85 @@ public:
      * 
      * @return T* 
      */
-    T *data() {
+    constexpr T *data() {
         return m_data;
     }
 
-    const T &front() const {
+    constexpr T const *data() const {
+        return m_data;
+    }
+
+    constexpr const T &front() const {
         return m_data[0];
     }
 
-    const T &back() const {
+    constexpr const T &back() const {
         return m_data[Size - 1];
     }
 
-    T &front() {
+    constexpr T &front() {
         return m_data[0];
     }
 
-    T &back() {
+    constexpr T &back() {
         return m_data[Size - 1];
     }
 
-    bool empty() const {
+    constexpr bool empty() const {
         return !Size;
     }
 
-    size_t size() const {
+    constexpr size_t size() const {
         return Size;
     }
 
-    size_t max_size() const {
+    constexpr size_t max_size() const {
         return size();
     }
 
-    ArrayIterator<T> begin() {
+    constexpr ArrayIterator<T> begin() {
         return m_data;
     }
 
-    ConstArrayIterator<T> cbegin() const {
+    constexpr ConstArrayIterator<T> cbegin() const {
         return m_data;
     }
 
-    ReverseArrayIterator<T> rbegin() {
-        return (m_data + Size - 1);
+    constexpr ReverseArrayIterator<T> rbegin() {
+        return m_data + Size;
     }
 
-    ConstReverseArrayIterator<T> crbegin() const {
-        return (m_data + Size - 1);
+    constexpr ConstReverseArrayIterator<T> crbegin() const {
+        return m_data + Size;
     }
 
-    ArrayIterator<T> end() {
+    constexpr ArrayIterator<T> end() {
         return m_data + Size;
     }
 
-    ConstArrayIterator<T> cend() const {
+    constexpr ConstArrayIterator<T> cend() const {
         return m_data + Size;
     }
 
-    ReverseArrayIterator<T> rend() {
-        return m_data - 1;
+    constexpr ReverseArrayIterator<T> rend() {
+        return m_data;
     }
 
-    ConstReverseArrayIterator<T> crend() const {
-        return m_data - 1;
+    constexpr ConstReverseArrayIterator<T> crend() const {
+        return m_data;
     }
 
     /**
      * @brief Applies Lambda that is not modifying the array
      * 
+     * @tparam Function callable as void(T const &)
      * @param f 
      */
-    Array const &forEach(std::function<void(T const &)> const &f) const {
-        for (ConstArrayIterator<T> i = cbegin(); i < cend(); i++)
+    template<typename Function>
+    constexpr Array const &forEach(Function &&f) const {
+        for (size_t i = 0; i < Size; i++)
         {
-            f(*i);
+            f(m_data[i]);
         }
         return *this;
     }
@@ -209,12 +243,14 @@ public:
     /**
      * @brief Applies Lambda that is modifying the referce to the array element
      * 
+     * @tparam Function callable as void(T &)
      * @param f 
      */
-    Array &transformReference(std::function<void(T &)> const &f) {
-        for (ArrayIterator<T> i = begin(); i < end(); i++)
+    template<typename Function>
+    constexpr Array &transformReference(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
         {
-            f(*i);
+            f(m_data[i]);
         }
         return *this;
     }
@@ -222,12 +258,14 @@ public:
     /**
      * @brief Applies Lambda that returns copy of modified element
      * 
+     * @tparam Function callable as T(T const &)
      * @param f 
      */
-    Array &transformAndCopy(std::function<T(T const &)> const &f) {
-        for (ArrayIterator<T> i = begin(); i < end(); i++)
+    template<typename Function>
+    constexpr Array &transformAndCopy(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
         {
-            *i = f(*i);
+            m_data[i] = f(m_data[i]);
         }
         return *this;
     }
@@ -236,14 +274,14 @@ public:
     /**
      * @brief Applies Lambda that is not modifying the array
      * 
+     * @tparam Function callable as void(T const &, size_t)
      * @param f 
      */
-    Array const &forEachWithIndex(std::function<void(T const &, size_t)> const &f) const {
-        size_t ind{};
-        for (ConstArrayIterator<T> i = cbegin(); i < cend(); i++)
+    template<typename Function>
+    constexpr Array const &forEachWithIndex(Function &&f) const {
+        for (size_t i = 0; i < Size; i++)
         {
-            f(*i, ind);
-            ind++;
+            f(m_data[i], i);
         }
         return *this;
     }
@@ -251,14 +289,14 @@ public:
     /**
      * @brief Applies Lambda that is modifying the referce to the array element
      * 
+     * @tparam Function callable as void(T &, size_t)
      * @param f 
      */
-    Array &transformReferenceWithIndex(std::function<void(T &, size_t)> const &f) {
-        size_t ind{};
-        for (ArrayIterator<T> i = begin(); i < end(); i++)
+    template<typename Function>
+    constexpr Array &transformReferenceWithIndex(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
         {
-            f(*i, ind);
-            ind++;
+            f(m_data[i], i);
         }
         return *this;
     }
@@ -266,20 +304,35 @@ public:
     /**
      * @brief Applies Lambda that returns copy of modified element
      * 
+     * @tparam Function callable as T(T const &, size_t)
      * @param f 
      */
-    Array &transformAndCopyWithIndex(std::function<T(T const &, size_t)> const &f) {
-        size_t ind{};
-        for (ArrayIterator<T> i = begin(); i < end(); i++)
+    template<typename Function>
+    constexpr Array &transformAndCopyWithIndex(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
         {
-            *i = f(*i, ind);
-            ind++;
+            m_data[i] = f(m_data[i], i);
         }
         return *this;
     }
 
+    /**
+     * @brief lazy Pipeline over the elements, e.g. arr.view().map(f).filter(g).sum() runs one fused loop
+     * 
+     * @return Pipeline 
+     */
+    constexpr auto view() const {
+        return pipelineOf(m_data, Size);
+    }
 
-    bool operator==(Array<T, Size> const &rhs) const {
+    /**
+     * @brief elements with BytewiseEquality are compared with memcmp outside of constant expressions
+     * 
+     */
+    constexpr bool operator==(Array<T, Size> const &rhs) const {
+        if constexpr (BytewiseEquality<T>::value) {
+            if(!__builtin_is_constant_evaluated()) return simdEqual(m_data, rhs.m_data, Size);
+        }
         for (size_t i = 0; i < Size; i++)
         {
             if(m_data[i] != rhs[i]) return false;
@@ -287,15 +340,246 @@ public:
         return true;
     }
 
-    bool operator!=(Array<T, Size> const &rhs) const {
+    constexpr bool operator!=(Array<T, Size> const &rhs) const {
         return !(*this == rhs);
     }
 
-    bool contains(T const &val) const {
+    constexpr bool contains(T const &val) const {
+        return indexOf(val) != Size;
+    }
+
+    /**
+     * @brief index of the first element equal to val, Size if there is none.
+     * Elements with BytewiseEquality are compared a vector at a time outside of constant expressions
+     * 
+     * @param val
+     * @return size_t
+     */
+    constexpr size_t indexOf(T const &val) const {
+        if constexpr (BytewiseEquality<T>::value) {
+            if(!__builtin_is_constant_evaluated()) return simdIndexOf(m_data, Size, val);
+        }
         for (size_t i = 0; i < Size; i++) {
-            if(m_data[i] == val) return true;
+            if(m_data[i] == val) return i;
         }
-        return false;
+        return Size;
+    }
+
+    /**
+     * @brief sum of all elements, floating point elements are summed pairwise
+     * 
+     * @return T
+     */
+    T sum() const {
+        static_assert(std::is_arithmetic<T>::value, "sum requires arithmetic T");
+        return simdSum(m_data, Size);
+    }
+
+    /**
+     * @brief smallest element, unspecified if there are NaN elements
+     * 
+     * @return T
+     */
+    T min() const {
+        static_assert(std::is_arithmetic<T>::value, "min requires arithmetic T");
+        return simdMin(m_data, Size);
+    }
+
+    /**
+     * @brief largest element, unspecified if there are NaN elements
+     * 
+     * @return T
+     */
+    T max() const {
+        static_assert(std::is_arithmetic<T>::value, "max requires arithmetic T");
+        return simdMax(m_data, Size);
+    }
+
+    /**
+     * @brief dot product with rhs
+     * 
+     * @param rhs
+     * @return T
+     */
+    T dot(Array<T, Size> const &rhs) const {
+        static_assert(std::is_arithmetic<T>::value, "dot requires arithmetic T");
+        return simdDot(m_data, rhs.m_data, Size);
+    }
+
+    /**
+     * @brief amount of elements equal to val, vectorized for BytewiseEquality and floating point elements
+     * 
+     * @param val
+     * @return size_t
+     */
+    size_t count(T const &val) const {
+        return simdCountEqual(m_data, Size, val);
+    }
+
+    /**
+     * @brief adds rhs elementwise
+     * 
+     * @param rhs
+     * @return Array&
+     */
+    Array &add(Array<T, Size> const &rhs) {
+        static_assert(std::is_arithmetic<T>::value, "add requires arithmetic T");
+        simdAdd(m_data, rhs.m_data, Size);
+        return *this;
+    }
+
+    /**
+     * @brief multiplies by rhs elementwise
+     * 
+     * @param rhs
+     * @return Array&
+     */
+    Array &mul(Array<T, Size> const &rhs) {
+        static_assert(std::is_arithmetic<T>::value, "mul requires arithmetic T");
+        simdMul(m_data, rhs.m_data, Size);
+        return *this;
+    }
+
+    /**
+     * @brief every element becomes element * b + c (elementwise)
+     * 
+     * @param b
+     * @param c
+     * @return Array&
+     */
+    Array &fma(Array<T, Size> const &b, Array<T, Size> const &c) {
+        static_assert(std::is_arithmetic<T>::value, "fma requires arithmetic T");
+        simdFma(m_data, b.m_data, c.m_data, Size);
+        return *this;
+    }
+
+    /**
+     * @brief multiplies every element by factor
+     * 
+     * @param factor
+     * @return Array&
+     */
+    Array &scale(T const &factor) {
+        static_assert(std::is_arithmetic<T>::value, "scale requires arithmetic T");
+        simdScale(m_data, factor, Size);
+        return *this;
+    }
+
+    /**
+     * @brief sorts ascending. Arithmetic arrays up to sortNetworkMaxSize elements use a sorting network,
+     * larger ones vectorQuicksort, the rest pdqSort. NaN elements are moved to the end. Not stable
+     * 
+     * @return Array&
+     */
+    Array &sort() {
+        if constexpr (std::is_arithmetic<T>::value && Size <= sortNetworkMaxSize) {
+            size_t numbers = sortNanLast(m_data, Size);
+            if(numbers == Size) sortNetwork<Size>(m_data);
+            else pdqSort(m_data, m_data + numbers, std::less<T>());
+        } else if constexpr (std::is_arithmetic<T>::value) {
+            vectorQuicksort(m_data, Size);
+        } else {
+            pdqSort(m_data, m_data + Size, std::less<T>());
+        }
+        return *this;
+    }
+
+    /**
+     * @brief sorts by comp with pdqSort. Not stable
+     * 
+     * @tparam Compare strict weak ordering
+     * @param comp 
+     * @return Array&
+     */
+    template<typename Compare>
+    Array &sort(Compare comp) {
+        pdqSort(m_data, m_data + Size, comp);
+        return *this;
+    }
+
+    constexpr bool isSorted() const {
+        return isSorted(std::less<T>());
+    }
+
+    template<typename Compare>
+    constexpr bool isSorted(Compare comp) const {
+        for (size_t i = 1; i < Size; i++)
+        {
+            if(comp(m_data[i], m_data[i - 1])) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief puts the count smallest elements sorted at the beginning, the order of the rest is unspecified.
+     * NaN elements count as greater than all the others.
+     * if count is greater than Size throws std::out_of_range
+     * 
+     * @param count 
+     * @return Array&
+     */
+    Array &partialSort(size_t count) {
+        if constexpr (std::is_floating_point<T>::value) {
+            if(count > Size) throw std::out_of_range("Count is out of range");
+            size_t numbers = sortNanLast(m_data, Size);
+            selectSmallest(m_data, m_data + numbers, std::min(count, numbers), std::less<T>());
+            pdqSort(m_data, m_data + std::min(count, numbers), std::less<T>());
+            return *this;
+        }
+        return partialSort(count, std::less<T>());
+    }
+
+    template<typename Compare>
+    Array &partialSort(size_t count, Compare comp) {
+        if(count > Size) throw std::out_of_range("Count is out of range");
+        if(count == 0) return *this;
+        selectSmallest(m_data, m_data + Size, count, comp);
+        pdqSort(m_data, m_data + count, comp);
+        return *this;
+    }
+
+    /**
+     * @brief index of the first element not less than val, Size if there is none.
+     * WARNING: the array must be sorted
+     * 
+     * @param val 
+     * @return size_t 
+     */
+    size_t lowerBound(T const &val) const {
+        return branchlessLowerBound(m_data, Size, val, std::less<T>());
+    }
+
+    template<typename Compare>
+    size_t lowerBound(T const &val, Compare comp) const {
+        return branchlessLowerBound(m_data, Size, val, comp);
+    }
+
+    /**
+     * @brief index of the first element greater than val, Size if there is none.
+     * WARNING: the array must be sorted
+     * 
+     * @param val 
+     * @return size_t 
+     */
+    size_t upperBound(T const &val) const {
+        return branchlessUpperBound(m_data, Size, val, std::less<T>());
+    }
+
+    template<typename Compare>
+    size_t upperBound(T const &val, Compare comp) const {
+        return branchlessUpperBound(m_data, Size, val, comp);
+    }
+
+    /**
+     * @brief contains in O(log n).
+     * WARNING: the array must be sorted
+     * 
+     * @param val 
+     * @return bool 
+     */
+    bool binarySearch(T const &val) const {
+        size_t i = lowerBound(val);
+        return i < Size && !(val < m_data[i]);
     }
 };
 
@@ -312,23 +596,32 @@ void print(Array<T, Size> const &arr) {
 
 template<typename T>
 class ArrayIterator {
+    friend ConstArrayIterator<T>;
+
     T *m_ptr;
 
 public:
-    ArrayIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+#if __cplusplus >= 202002L
+    typedef std::contiguous_iterator_tag iterator_concept;
+#endif
+    typedef std::remove_const_t<T> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef T *pointer;
+    typedef T &reference;
+
+    constexpr ArrayIterator() : m_ptr(nullptr) {}
     
-    ArrayIterator(T *ptr) : m_ptr(ptr) {}
+    constexpr ArrayIterator(T *ptr) : m_ptr(ptr) {}
     
-    ArrayIterator(const ArrayIterator<T> &ArrayIterator) {
-        m_ptr = ArrayIterator.m_ptr;
-    }
+    constexpr ArrayIterator(const ArrayIterator<T> &ArrayIterator) : m_ptr(ArrayIterator.m_ptr) {}
 
     /**
      * @brief Advances ArrayIterator on n positions
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    constexpr void advance(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -337,7 +630,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    constexpr void retreat(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -347,85 +640,97 @@ public:
      * @param rhs 
      * @return ptrdiff_t 
      */
-    ptrdiff_t disctance(ArrayIterator<T> const &rhs) const {
+    constexpr ptrdiff_t disctance(ArrayIterator<T> const &rhs) const {
         return rhs.m_ptr - m_ptr;
     }
 
-    ArrayIterator &next(size_t n = 1) {
+    constexpr ArrayIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    ArrayIterator &prev(size_t n = 1) {
+    constexpr ArrayIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
 
-    T &operator*() const {
+    constexpr T &operator*() const {
         return *m_ptr;
     }
 
-    ArrayIterator operator+(size_t n) const {
+    constexpr pointer operator->() const {
+        return m_ptr;
+    }
+
+    constexpr reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    constexpr ArrayIterator operator+(difference_type n) const {
         return ArrayIterator(m_ptr + n);
     }
 
-    ArrayIterator operator-(size_t n) const {
+    constexpr ArrayIterator operator-(difference_type n) const {
         return ArrayIterator(m_ptr - n);
     }
 
-    ptrdiff_t operator-(ArrayIterator<T> const &rhs) const {
-        return disctance(rhs);
+    constexpr difference_type operator-(ArrayIterator<T> const &rhs) const {
+        return -disctance(rhs);
     }
 
-    ArrayIterator &operator+=(size_t n) {
+    friend constexpr ArrayIterator operator+(difference_type n, ArrayIterator const &it) {
+        return it + n;
+    }
+
+    constexpr ArrayIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    ArrayIterator &operator-=(size_t n) {
+    constexpr ArrayIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
-    ArrayIterator &operator++() {
+    constexpr ArrayIterator &operator++() {
         return next();
     }
 
-    ArrayIterator &operator--() {
+    constexpr ArrayIterator &operator--() {
         return prev();
     }
 
-    ArrayIterator operator++(int) {
+    constexpr ArrayIterator operator++(int) {
         ArrayIterator ai{m_ptr};
         next();
         return ai;
     }
 
-    ArrayIterator operator--(int) {
+    constexpr ArrayIterator operator--(int) {
         ArrayIterator ai{m_ptr};
         prev();
         return ai;
     }
 
-    bool operator==(ArrayIterator<T> const &rhs) const {
+    constexpr bool operator==(ArrayIterator<T> const &rhs) const {
         return m_ptr == rhs.m_ptr;
     }
 
-    bool operator!=(ArrayIterator<T> const &rhs) const {
+    constexpr bool operator!=(ArrayIterator<T> const &rhs) const {
         return m_ptr != rhs.m_ptr;
     }
 
-    bool operator>(ArrayIterator<T> const &rhs) const {
+    constexpr bool operator>(ArrayIterator<T> const &rhs) const {
         return m_ptr > rhs.m_ptr;
     }
 
-    bool operator<(ArrayIterator<T> const &rhs) const {
+    constexpr bool operator<(ArrayIterator<T> const &rhs) const {
         return m_ptr < rhs.m_ptr;
     }
 
-    bool operator>=(ArrayIterator<T> const &rhs) const {
+    constexpr bool operator>=(ArrayIterator<T> const &rhs) const {
         return m_ptr >= rhs.m_ptr;
     }
 
-    bool operator<=(ArrayIterator<T> const &rhs) const {
+    constexpr bool operator<=(ArrayIterator<T> const &rhs) const {
         return m_ptr <= rhs.m_ptr;
     }
 };
@@ -435,24 +740,29 @@ class ConstArrayIterator {
     T const *m_ptr;
 
 public:
-    ConstArrayIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+#if __cplusplus >= 202002L
+    typedef std::contiguous_iterator_tag iterator_concept;
+#endif
+    typedef std::remove_const_t<T const> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef T const *pointer;
+    typedef T const &reference;
+
+    constexpr ConstArrayIterator() : m_ptr(nullptr) {}
     
-    ConstArrayIterator(T const *ptr) : m_ptr(ptr) {}
+    constexpr ConstArrayIterator(T const *ptr) : m_ptr(ptr) {}
     
-    ConstArrayIterator(const ConstArrayIterator<T> &constArrayIterator) {
-        m_ptr = constArrayIterator.m_ptr;
-    }
+    constexpr ConstArrayIterator(const ConstArrayIterator<T> &constArrayIterator) : m_ptr(constArrayIterator.m_ptr) {}
 
-    ConstArrayIterator(const ArrayIterator<T> &arrayIterator) {
-        m_ptr = arrayIterator.m_ptr;
-    }
+    constexpr ConstArrayIterator(const ArrayIterator<T> &arrayIterator) : m_ptr(arrayIterator.m_ptr) {}
 
     /**
      * @brief Advances ConstArrayIterator on n positions
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    constexpr void advance(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -461,7 +771,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    constexpr void retreat(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -471,85 +781,97 @@ public:
      * @param rhs 
      * @return ptrdiff_t 
      */
-    ptrdiff_t disctance(ConstArrayIterator<T> const &rhs) const {
+    constexpr ptrdiff_t disctance(ConstArrayIterator<T> const &rhs) const {
         return rhs.m_ptr - m_ptr;
     }
 
-    ConstArrayIterator &next(size_t n = 1) {
+    constexpr ConstArrayIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    ConstArrayIterator &prev(size_t n = 1) {
+    constexpr ConstArrayIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
 
-    T const &operator*() const {
+    constexpr T const &operator*() const {
         return *m_ptr;
     }
 
-    ConstArrayIterator operator+(size_t n) const {
+    constexpr pointer operator->() const {
+        return m_ptr;
+    }
+
+    constexpr reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    constexpr ConstArrayIterator operator+(difference_type n) const {
         return ConstArrayIterator(m_ptr + n);
     }
 
-    ConstArrayIterator operator-(size_t n) const {
+    constexpr ConstArrayIterator operator-(difference_type n) const {
         return ConstArrayIterator(m_ptr - n);
     }
 
-    ptrdiff_t operator-(ConstArrayIterator<T> const &rhs) const {
-        return disctance(rhs);
+    constexpr difference_type operator-(ConstArrayIterator<T> const &rhs) const {
+        return -disctance(rhs);
     }
 
-    ConstArrayIterator &operator+=(size_t n) {
+    friend constexpr ConstArrayIterator operator+(difference_type n, ConstArrayIterator const &it) {
+        return it + n;
+    }
+
+    constexpr ConstArrayIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    ConstArrayIterator &operator-=(size_t n) {
+    constexpr ConstArrayIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
-    ConstArrayIterator &operator++() {
+    constexpr ConstArrayIterator &operator++() {
         return next();
     }
 
-    ConstArrayIterator &operator--() {
+    constexpr ConstArrayIterator &operator--() {
         return prev();
     }
 
-    ConstArrayIterator operator++(int) {
+    constexpr ConstArrayIterator operator++(int) {
         ConstArrayIterator cai{m_ptr};
         next();
         return cai;
     }
 
-    ConstArrayIterator operator--(int) {
+    constexpr ConstArrayIterator operator--(int) {
         ConstArrayIterator cai{m_ptr};
         prev();
         return cai;
     }
 
-    bool operator==(ConstArrayIterator<T> const &rhs) const {
+    constexpr bool operator==(ConstArrayIterator<T> const &rhs) const {
         return m_ptr == rhs.m_ptr;
     }
 
-    bool operator!=(ConstArrayIterator<T> const &rhs) const {
+    constexpr bool operator!=(ConstArrayIterator<T> const &rhs) const {
         return m_ptr != rhs.m_ptr;
     }
 
-    bool operator>(ConstArrayIterator<T> const &rhs) const {
+    constexpr bool operator>(ConstArrayIterator<T> const &rhs) const {
         return m_ptr > rhs.m_ptr;
     }
 
-    bool operator<(ConstArrayIterator<T> const &rhs) const {
+    constexpr bool operator<(ConstArrayIterator<T> const &rhs) const {
         return m_ptr < rhs.m_ptr;
     }
 
-    bool operator>=(ConstArrayIterator<T> const &rhs) const {
+    constexpr bool operator>=(ConstArrayIterator<T> const &rhs) const {
         return m_ptr >= rhs.m_ptr;
     }
 
-    bool operator<=(ConstArrayIterator<T> const &rhs) const {
+    constexpr bool operator<=(ConstArrayIterator<T> const &rhs) const {
         return m_ptr <= rhs.m_ptr;
     }
 };
@@ -560,23 +882,30 @@ public:
 
 template<typename T>
 class ReverseArrayIterator {
+    friend ConstReverseArrayIterator<T>;
+
+    // points one past the referenced element, so rend() does not point before the array
     T *m_ptr;
 
 public:
-    ReverseArrayIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef std::remove_const_t<T> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef T *pointer;
+    typedef T &reference;
+
+    constexpr ReverseArrayIterator() : m_ptr(nullptr) {}
     
-    ReverseArrayIterator(T *ptr) : m_ptr(ptr) {}
+    constexpr ReverseArrayIterator(T *ptr) : m_ptr(ptr) {}
     
-    ReverseArrayIterator(const ReverseArrayIterator<T> &ReverseArrayIterator) {
-        m_ptr = ReverseArrayIterator.m_ptr;
-    }
+    constexpr ReverseArrayIterator(const ReverseArrayIterator<T> &ReverseArrayIterator) : m_ptr(ReverseArrayIterator.m_ptr) {}
 
     /**
      * @brief Advances ReverseArrayIterator on n positions
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    constexpr void advance(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -585,7 +914,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    constexpr void retreat(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -595,112 +924,127 @@ public:
      * @param rhs 
      * @return ptrdiff_t 
      */
-    ptrdiff_t disctance(ReverseArrayIterator<T> const &rhs) const {
+    constexpr ptrdiff_t disctance(ReverseArrayIterator<T> const &rhs) const {
         return m_ptr - rhs.m_ptr;
     }
 
-    ReverseArrayIterator &next(size_t n = 1) {
+    constexpr ReverseArrayIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    ReverseArrayIterator &prev(size_t n = 1) {
+    constexpr ReverseArrayIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
 
-    T &operator*() const {
-        return *m_ptr;
+    constexpr T &operator*() const {
+        return *(m_ptr - 1);
     }
 
-    ReverseArrayIterator operator+(size_t n) const {
+    constexpr pointer operator->() const {
+        return m_ptr - 1;
+    }
+
+    constexpr reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    constexpr ReverseArrayIterator operator+(difference_type n) const {
         return ReverseArrayIterator(m_ptr - n);
     }
 
-    ReverseArrayIterator operator-(size_t n) const {
+    constexpr ReverseArrayIterator operator-(difference_type n) const {
         return ReverseArrayIterator(m_ptr + n);
     }
 
-    ptrdiff_t operator-(ReverseArrayIterator<T> const &rhs) const {
-        return disctance(rhs);
+    constexpr difference_type operator-(ReverseArrayIterator<T> const &rhs) const {
+        return -disctance(rhs);
+    }
+
+    friend constexpr ReverseArrayIterator operator+(difference_type n, ReverseArrayIterator const &it) {
+        return it + n;
     }
 
-    ReverseArrayIterator &operator+=(size_t n) {
+    constexpr ReverseArrayIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    ReverseArrayIterator &operator-=(size_t n) {
+    constexpr ReverseArrayIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
-    ReverseArrayIterator &operator++() {
+    constexpr ReverseArrayIterator &operator++() {
         return next();
     }
 
-    ReverseArrayIterator &operator--() {
+    constexpr ReverseArrayIterator &operator--() {
         return prev();
     }
 
-    ReverseArrayIterator operator++(int) {
+    constexpr ReverseArrayIterator operator++(int) {
         ReverseArrayIterator rai{m_ptr};
         next();
         return rai;
     }
 
-    ReverseArrayIterator operator--(int) {
+    constexpr ReverseArrayIterator operator--(int) {
         ReverseArrayIterator rai{m_ptr};
         prev();
         return rai;
     }
 
-    bool operator==(ReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator==(ReverseArrayIterator<T> const &rhs) const {
         return m_ptr == rhs.m_ptr;
     }
 
-    bool operator!=(ReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator!=(ReverseArrayIterator<T> const &rhs) const {
         return m_ptr != rhs.m_ptr;
     }
 
-    bool operator>(ReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator>(ReverseArrayIterator<T> const &rhs) const {
         return m_ptr < rhs.m_ptr;
     }
 
-    bool operator<(ReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator<(ReverseArrayIterator<T> const &rhs) const {
         return m_ptr > rhs.m_ptr;
     }
 
-    bool operator>=(ReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator>=(ReverseArrayIterator<T> const &rhs) const {
         return m_ptr <= rhs.m_ptr;
     }
 
-    bool operator<=(ReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator<=(ReverseArrayIterator<T> const &rhs) const {
         return m_ptr >= rhs.m_ptr;
     }
 };
 
 template<typename T>
 class ConstReverseArrayIterator {
+    // points one past the referenced element, so rend() does not point before the array
     T const *m_ptr;
 
 public:
-    ConstReverseArrayIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef std::remove_const_t<T const> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef T const *pointer;
+    typedef T const &reference;
+
+    constexpr ConstReverseArrayIterator() : m_ptr(nullptr) {}
     
-    ConstReverseArrayIterator(T const *ptr) : m_ptr(ptr) {}
+    constexpr ConstReverseArrayIterator(T const *ptr) : m_ptr(ptr) {}
     
-    ConstReverseArrayIterator(const ConstReverseArrayIterator<T> &constReverseArrayIterator) {
-        m_ptr = constReverseArrayIterator.m_ptr;
-    }
+    constexpr ConstReverseArrayIterator(const ConstReverseArrayIterator<T> &constReverseArrayIterator) : m_ptr(constReverseArrayIterator.m_ptr) {}
 
-    ConstReverseArrayIterator(const ReverseArrayIterator<T> &arrayIterator) {
-        m_ptr = arrayIterator.m_ptr;
-    }
+    constexpr ConstReverseArrayIterator(const ReverseArrayIterator<T> &arrayIterator) : m_ptr(arrayIterator.m_ptr) {}
 
     /**
      * @brief Advances ConstReverseArrayIterator on n positions
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    constexpr void advance(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -709,7 +1053,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    constexpr void retreat(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -719,85 +1063,97 @@ public:
      * @param rhs 
      * @return ptrdiff_t 
      */
-    ptrdiff_t disctance(ConstReverseArrayIterator<T> const &rhs) const {
+    constexpr ptrdiff_t disctance(ConstReverseArrayIterator<T> const &rhs) const {
         return m_ptr - rhs.m_ptr;
     }
 
-    ConstReverseArrayIterator &next(size_t n = 1) {
+    constexpr ConstReverseArrayIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    ConstReverseArrayIterator &prev(size_t n = 1) {
+    constexpr ConstReverseArrayIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
 
-    T const &operator*() const {
-        return *m_ptr;
+    constexpr T const &operator*() const {
+        return *(m_ptr - 1);
     }
 
-    ConstReverseArrayIterator operator+(size_t n) const {
+    constexpr pointer operator->() const {
+        return m_ptr - 1;
+    }
+
+    constexpr reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    constexpr ConstReverseArrayIterator operator+(difference_type n) const {
         return ConstReverseArrayIterator(m_ptr - n);
     }
 
-    ConstReverseArrayIterator operator-(size_t n) const {
+    constexpr ConstReverseArrayIterator operator-(difference_type n) const {
         return ConstReverseArrayIterator(m_ptr + n);
     }
 
-    ptrdiff_t operator-(ConstReverseArrayIterator<T> const &rhs) const {
-        return disctance(rhs);
+    constexpr difference_type operator-(ConstReverseArrayIterator<T> const &rhs) const {
+        return -disctance(rhs);
+    }
+
+    friend constexpr ConstReverseArrayIterator operator+(difference_type n, ConstReverseArrayIterator const &it) {
+        return it + n;
     }
 
-    ConstReverseArrayIterator &operator+=(size_t n) {
+    constexpr ConstReverseArrayIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    ConstReverseArrayIterator &operator-=(size_t n) {
+    constexpr ConstReverseArrayIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
-    ConstReverseArrayIterator &operator++() {
+    constexpr ConstReverseArrayIterator &operator++() {
         return next();
     }
 
-    ConstReverseArrayIterator &operator--() {
+    constexpr ConstReverseArrayIterator &operator--() {
         return prev();
     }
 
-    ConstReverseArrayIterator operator++(int) {
+    constexpr ConstReverseArrayIterator operator++(int) {
         ConstReverseArrayIterator crai{m_ptr};
         next();
         return crai;
     }
 
-    ConstReverseArrayIterator operator--(int) {
+    constexpr ConstReverseArrayIterator operator--(int) {
         ConstReverseArrayIterator crai{m_ptr};
         prev();
         return crai;
     }
 
-    bool operator==(ConstReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator==(ConstReverseArrayIterator<T> const &rhs) const {
         return m_ptr == rhs.m_ptr;
     }
 
-    bool operator!=(ConstReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator!=(ConstReverseArrayIterator<T> const &rhs) const {
         return m_ptr != rhs.m_ptr;
     }
 
-    bool operator>(ConstReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator>(ConstReverseArrayIterator<T> const &rhs) const {
         return m_ptr < rhs.m_ptr;
     }
 
-    bool operator<(ConstReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator<(ConstReverseArrayIterator<T> const &rhs) const {
         return m_ptr > rhs.m_ptr;
     }
 
-    bool operator>=(ConstReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator>=(ConstReverseArrayIterator<T> const &rhs) const {
         return m_ptr <= rhs.m_ptr;
     }
 
-    bool operator<=(ConstReverseArrayIterator<T> const &rhs) const {
+    constexpr bool operator<=(ConstReverseArrayIterator<T> const &rhs) const {
         return m_ptr >= rhs.m_ptr;
     }
 };
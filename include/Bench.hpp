@@ -0,0 +1,55 @@
+/**
+ * @file Bench.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief 
+ * @version 0.1
+ * @date 2022-04-07
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+
+#define BENCH_INIT(Name) \
+std::cout << "\nInitializing benchmark suite \"" << #Name << "\"\n\n";
+
+/**
+ * @brief keeps the compiler from optimizing away a computed value
+ * 
+ * @tparam T 
+ * @param val 
+ */
+template<typename T>
+void doNotOptimize(T const &val) {
+    asm volatile("" : : "r,m"(val) : "memory");
+}
+
+/**
+ * @brief runs f repeats times, prints the best time and throughput for bytes processed by one run
+ * 
+ * @tparam Function 
+ * @param name 
+ * @param bytes 
+ * @param repeats 
+ * @param f 
+ * @return double best time in seconds
+ */
+template<typename Function>
+double benchmark(char const *name, size_t bytes, size_t repeats, Function &&f) {
+    double best = 1e300;
+    for (size_t i = 0; i < repeats; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if(elapsed.count() < best) best = elapsed.count();
+    }
+    std::cout << name << ": " << best * 1e3 << " ms";
+    if(bytes) std::cout << ", " << bytes / best / 1e9 << " GB/s";
+    std::cout << "\n";
+    return best;
+}
@@ -0,0 +1,712 @@
+/**
+ * @file BitArray.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the BitArray, BitVector and RankSelect classes
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <Simd.hpp>
+#include <Vector.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace TAS
+{
+
+/**
+ * @brief amount of 64 bit words holding size bits
+ * 
+ */
+constexpr size_t bitWordCount(size_t size) {
+    return (size + 63) / 64;
+}
+
+/**
+ * @brief mask of the used bits of the last word of size bits
+ * 
+ */
+constexpr uint64_t bitLastWordMask(size_t size) {
+    return size % 64 ? (uint64_t{1} << (size % 64)) - 1 : ~uint64_t{0};
+}
+
+/**
+ * @brief index of the first set bit at index or after it, size if there is none.
+ * Bits past size must be zero
+ * 
+ */
+inline size_t bitFindFrom(uint64_t const *words, size_t size, size_t index) {
+    if(index >= size) return size;
+    size_t word = index / 64;
+    uint64_t bits = words[word] & (~uint64_t{0} << (index % 64));
+    size_t wordCount = bitWordCount(size);
+    while(!bits) {
+        if(++word == wordCount) return size;
+        bits = words[word];
+    }
+    return word * 64 + __builtin_ctzll(bits);
+}
+
+/**
+ * @brief index of the k-th (from 0) set bit of word, k must be less than the amount of set bits
+ * 
+ */
+inline size_t bitSelectInWord(uint64_t word, size_t k) {
+#if defined(__BMI2__)
+    return __builtin_ctzll(_pdep_u64(uint64_t{1} << k, word));
+#else
+    for (size_t i = 0; i < k; i++)
+    {
+        word &= word - 1;
+    }
+    return __builtin_ctzll(word);
+#endif
+}
+
+/**
+ * @brief fixed size set of N bits packed in 64 bit words. and/or/xor work a vector of words at a time,
+ * count() uses simdPopcount. Bits past N in the last word are always zero
+ * 
+ * @tparam N amount of bits
+ */
+template<size_t N>
+class BitArray {
+    static_assert(N > 0, "BitArray needs at least one bit");
+
+public:
+    /**
+     * @brief amount of 64 bit words
+     * 
+     */
+    static constexpr size_t wordCount = bitWordCount(N);
+
+private:
+    Array<uint64_t, wordCount> m_words;
+
+public:
+    /**
+     * @brief Construct a new Bit Array object with all bits cleared
+     * 
+     */
+    constexpr BitArray() = default;
+
+    /**
+     * @brief Construct a new Bit Array object with all bits set to val
+     * 
+     * @param val
+     */
+    explicit BitArray(bool val) {
+        fill(val);
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return bool
+     */
+    bool operator[](size_t index) const {
+        return m_words[index / 64] >> (index % 64) & 1;
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return bool
+     */
+    bool at(size_t index) const {
+        if(index >= N) throw std::out_of_range("Index is out of range");
+        return (*this)[index];
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     */
+    BitArray &set(size_t index, bool val = true) {
+        uint64_t bit = uint64_t{1} << (index % 64);
+        if(val) m_words[index / 64] |= bit;
+        else m_words[index / 64] &= ~bit;
+        return *this;
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     */
+    BitArray &reset(size_t index) {
+        return set(index, false);
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     */
+    BitArray &flip(size_t index) {
+        m_words[index / 64] ^= uint64_t{1} << (index % 64);
+        return *this;
+    }
+
+    /**
+     * @brief sets all bits to val
+     * 
+     * @param val
+     */
+    BitArray &fill(bool val) {
+        m_words.fill(val ? ~uint64_t{0} : 0);
+        m_words[wordCount - 1] &= bitLastWordMask(N);
+        return *this;
+    }
+
+    /**
+     * @brief inverts all bits
+     * 
+     */
+    BitArray &flip() {
+        for (size_t i = 0; i < wordCount; i++)
+        {
+            m_words[i] = ~m_words[i];
+        }
+        m_words[wordCount - 1] &= bitLastWordMask(N);
+        return *this;
+    }
+
+    BitArray &operator&=(BitArray const &rhs) {
+        simdBitwise<BitOp::And>(m_words.data(), rhs.m_words.data(), wordCount);
+        return *this;
+    }
+
+    BitArray &operator|=(BitArray const &rhs) {
+        simdBitwise<BitOp::Or>(m_words.data(), rhs.m_words.data(), wordCount);
+        return *this;
+    }
+
+    BitArray &operator^=(BitArray const &rhs) {
+        simdBitwise<BitOp::Xor>(m_words.data(), rhs.m_words.data(), wordCount);
+        return *this;
+    }
+
+    /**
+     * @brief clears the bits that are set in rhs
+     * 
+     * @param rhs
+     */
+    BitArray &andNot(BitArray const &rhs) {
+        simdBitwise<BitOp::AndNot>(m_words.data(), rhs.m_words.data(), wordCount);
+        return *this;
+    }
+
+    BitArray operator&(BitArray const &rhs) const {
+        return BitArray(*this) &= rhs;
+    }
+
+    BitArray operator|(BitArray const &rhs) const {
+        return BitArray(*this) |= rhs;
+    }
+
+    BitArray operator^(BitArray const &rhs) const {
+        return BitArray(*this) ^= rhs;
+    }
+
+    BitArray operator~() const {
+        return BitArray(*this).flip();
+    }
+
+    bool operator==(BitArray const &rhs) const {
+        return m_words == rhs.m_words;
+    }
+
+    bool operator!=(BitArray const &rhs) const {
+        return !(m_words == rhs.m_words);
+    }
+
+    /**
+     * @brief amount of set bits
+     * 
+     * @return size_t
+     */
+    size_t count() const {
+        return simdPopcount(m_words.data(), wordCount);
+    }
+
+    bool any() const {
+        return findFirstSet() != N;
+    }
+
+    bool none() const {
+        return !any();
+    }
+
+    bool all() const {
+        return count() == N;
+    }
+
+    /**
+     * @brief index of the first set bit, size() if there is none
+     * 
+     * @return size_t
+     */
+    size_t findFirstSet() const {
+        return bitFindFrom(m_words.data(), N, 0);
+    }
+
+    /**
+     * @brief index of the first set bit after index, size() if there is none
+     * 
+     * @param index
+     * @return size_t
+     */
+    size_t findNextSet(size_t index) const {
+        return bitFindFrom(m_words.data(), N, index + 1);
+    }
+
+    /**
+     * @brief Applies Lambda to the index of every set bit in ascending order, skipping zero words
+     * 
+     * @tparam Function callable as void(size_t)
+     * @param f
+     */
+    template<typename Function>
+    BitArray const &forEachSet(Function &&f) const {
+        for (size_t i = 0; i < wordCount; i++)
+        {
+            for (uint64_t bits = m_words[i]; bits; bits &= bits - 1)
+            {
+                f(i * 64 + __builtin_ctzll(bits));
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief raw words, bit i is bit i % 64 of word i / 64
+     * 
+     * @return uint64_t const*
+     */
+    uint64_t const *words() const {
+        return m_words.data();
+    }
+
+    /**
+     * @brief WARNING: bits past size() must stay zero
+     * 
+     * @return uint64_t*
+     */
+    uint64_t *words() {
+        return m_words.data();
+    }
+
+    static constexpr size_t size() {
+        return N;
+    }
+};
+
+/**
+ * @brief dynamically sized BitArray. Bulk operations between BitVectors of different sizes throw std::invalid_argument
+ * 
+ */
+class BitVector {
+    Vector<uint64_t> m_words;
+    size_t m_size{};
+
+    void checkSize(BitVector const &rhs) const {
+        if(rhs.m_size != m_size) throw std::invalid_argument("BitVectors have different sizes");
+    }
+
+    void clearTail() {
+        if(m_size) m_words.back() &= bitLastWordMask(m_size);
+    }
+
+public:
+    BitVector() = default;
+
+    /**
+     * @brief Construct a new Bit Vector object of size bits set to val
+     * 
+     * @param size
+     * @param val
+     */
+    explicit BitVector(size_t size, bool val = false) : m_words(bitWordCount(size), val ? ~uint64_t{0} : 0), m_size(size) {
+        clearTail();
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return bool
+     */
+    bool operator[](size_t index) const {
+        return m_words[index / 64] >> (index % 64) & 1;
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return bool
+     */
+    bool at(size_t index) const {
+        if(index >= m_size) throw std::out_of_range("Index is out of range");
+        return (*this)[index];
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     */
+    BitVector &set(size_t index, bool val = true) {
+        uint64_t bit = uint64_t{1} << (index % 64);
+        if(val) m_words[index / 64] |= bit;
+        else m_words[index / 64] &= ~bit;
+        return *this;
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     */
+    BitVector &reset(size_t index) {
+        return set(index, false);
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     */
+    BitVector &flip(size_t index) {
+        m_words[index / 64] ^= uint64_t{1} << (index % 64);
+        return *this;
+    }
+
+    /**
+     * @brief appends one bit
+     * 
+     * @param val
+     */
+    BitVector &pushBack(bool val) {
+        if(m_size % 64 == 0) m_words.pushBack(0);
+        m_size++;
+        return set(m_size - 1, val);
+    }
+
+    /**
+     * @brief changes the amount of bits, new bits are set to val
+     * 
+     * @param size
+     * @param val
+     */
+    BitVector &resize(size_t size, bool val = false) {
+        size_t oldSize = m_size;
+        if(val && size > oldSize && oldSize % 64) m_words.back() |= ~bitLastWordMask(oldSize);
+        m_words.resize(bitWordCount(size), val ? ~uint64_t{0} : 0);
+        m_size = size;
+        clearTail();
+        return *this;
+    }
+
+    BitVector &clear() {
+        m_words.clear();
+        m_size = 0;
+        return *this;
+    }
+
+    /**
+     * @brief makes room for size bits
+     * 
+     * @param size
+     */
+    BitVector &reserve(size_t size) {
+        m_words.reserve(bitWordCount(size));
+        return *this;
+    }
+
+    /**
+     * @brief sets all bits to val
+     * 
+     * @param val
+     */
+    BitVector &fill(bool val) {
+        for (uint64_t &word : m_words) {
+            word = val ? ~uint64_t{0} : 0;
+        }
+        clearTail();
+        return *this;
+    }
+
+    /**
+     * @brief inverts all bits
+     * 
+     */
+    BitVector &flip() {
+        for (uint64_t &word : m_words) {
+            word = ~word;
+        }
+        clearTail();
+        return *this;
+    }
+
+    BitVector &operator&=(BitVector const &rhs) {
+        checkSize(rhs);
+        simdBitwise<BitOp::And>(m_words.data(), rhs.m_words.data(), m_words.size());
+        return *this;
+    }
+
+    BitVector &operator|=(BitVector const &rhs) {
+        checkSize(rhs);
+        simdBitwise<BitOp::Or>(m_words.data(), rhs.m_words.data(), m_words.size());
+        return *this;
+    }
+
+    BitVector &operator^=(BitVector const &rhs) {
+        checkSize(rhs);
+        simdBitwise<BitOp::Xor>(m_words.data(), rhs.m_words.data(), m_words.size());
+        return *this;
+    }
+
+    /**
+     * @brief clears the bits that are set in rhs
+     * 
+     * @param rhs
+     */
+    BitVector &andNot(BitVector const &rhs) {
+        checkSize(rhs);
+        simdBitwise<BitOp::AndNot>(m_words.data(), rhs.m_words.data(), m_words.size());
+        return *this;
+    }
+
+    BitVector operator&(BitVector const &rhs) const {
+        return BitVector(*this) &= rhs;
+    }
+
+    BitVector operator|(BitVector const &rhs) const {
+        return BitVector(*this) |= rhs;
+    }
+
+    BitVector operator^(BitVector const &rhs) const {
+        return BitVector(*this) ^= rhs;
+    }
+
+    BitVector operator~() const {
+        return BitVector(*this).flip();
+    }
+
+    bool operator==(BitVector const &rhs) const {
+        return m_size == rhs.m_size && m_words == rhs.m_words;
+    }
+
+    bool operator!=(BitVector const &rhs) const {
+        return !(*this == rhs);
+    }
+
+    /**
+     * @brief amount of set bits
+     * 
+     * @return size_t
+     */
+    size_t count() const {
+        return simdPopcount(m_words.data(), m_words.size());
+    }
+
+    bool any() const {
+        return findFirstSet() != m_size;
+    }
+
+    bool none() const {
+        return !any();
+    }
+
+    bool all() const {
+        return count() == m_size;
+    }
+
+    /**
+     * @brief index of the first set bit, size() if there is none
+     * 
+     * @return size_t
+     */
+    size_t findFirstSet() const {
+        return bitFindFrom(m_words.data(), m_size, 0);
+    }
+
+    /**
+     * @brief index of the first set bit after index, size() if there is none
+     * 
+     * @param index
+     * @return size_t
+     */
+    size_t findNextSet(size_t index) const {
+        return bitFindFrom(m_words.data(), m_size, index + 1);
+    }
+
+    /**
+     * @brief Applies Lambda to the index of every set bit in ascending order, skipping zero words
+     * 
+     * @tparam Function callable as void(size_t)
+     * @param f
+     */
+    template<typename Function>
+    BitVector const &forEachSet(Function &&f) const {
+        for (size_t i = 0; i < m_words.size(); i++)
+        {
+            for (uint64_t bits = m_words[i]; bits; bits &= bits - 1)
+            {
+                f(i * 64 + __builtin_ctzll(bits));
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief raw words, bit i is bit i % 64 of word i / 64
+     * 
+     * @return uint64_t const*
+     */
+    uint64_t const *words() const {
+        return m_words.data();
+    }
+
+    /**
+     * @brief WARNING: bits past size() must stay zero
+     * 
+     * @return uint64_t*
+     */
+    uint64_t *words() {
+        return m_words.data();
+    }
+
+    size_t wordCount() const {
+        return m_words.size();
+    }
+
+    bool empty() const {
+        return !m_size;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+};
+
+/**
+ * @brief rank and select index over a bit set: the amount of set bits before every block of 512 bits
+ * (one cache line) is stored, so rank reads one count and at most 8 words. select looks up the blocks
+ * of every 4096th set bit, binary searches the counts between them and scans one block.
+ * Takes about 1/8 bit extra per bit.
+ * WARNING: it does not own the bits, they must outlive the RankSelect and must not change
+ * 
+ */
+class RankSelect {
+    static constexpr size_t blockWords{8};
+    static constexpr size_t selectSample{4096};
+
+    uint64_t const *m_words{nullptr};
+    size_t m_size{};
+    Vector<uint64_t> m_blockRanks;
+    // block of every selectSample-th set bit
+    Vector<uint64_t> m_selectSamples;
+
+public:
+    RankSelect() = default;
+
+    /**
+     * @brief Construct a new Rank Select object over size bits stored in words
+     * 
+     * @param words
+     * @param size
+     */
+    RankSelect(uint64_t const *words, size_t size) : m_words(words), m_size(size) {
+        size_t wordCount = bitWordCount(size);
+        size_t blocks = (wordCount + blockWords - 1) / blockWords;
+        m_blockRanks.reserve(blocks + 1);
+        uint64_t rank{};
+        for (size_t b = 0; b < blocks; b++)
+        {
+            m_blockRanks.pushBack(rank);
+            size_t first = b * blockWords;
+            rank += simdPopcount(words + first, wordCount - first < blockWords ? wordCount - first : blockWords);
+            while(m_selectSamples.size() * selectSample < rank) m_selectSamples.pushBack(b);
+        }
+        m_blockRanks.pushBack(rank);
+    }
+
+    /**
+     * @brief Construct a new Rank Select object over a BitArray or BitVector
+     * 
+     * @param bits
+     */
+    template<typename Bits>
+    explicit RankSelect(Bits const &bits) : RankSelect(bits.words(), bits.size()) {}
+
+    /**
+     * @brief amount of set bits
+     * 
+     * @return size_t
+     */
+    size_t count() const {
+        return m_blockRanks.back();
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief amount of set bits before index, if index > size() throws std::out_of_range
+     * 
+     * @param index
+     * @return size_t
+     */
+    size_t rank(size_t index) const {
+        if(index > m_size) throw std::out_of_range("Index is out of range");
+        size_t word = index / 64;
+        size_t res = m_blockRanks[word / blockWords];
+        for (size_t i = word - word % blockWords; i < word; i++)
+        {
+            res += __builtin_popcountll(m_words[i]);
+        }
+        if(index % 64) res += __builtin_popcountll(m_words[word] & bitLastWordMask(index));
+        return res;
+    }
+
+    /**
+     * @brief index of the k-th (from 0) set bit, if k >= count() throws std::out_of_range
+     * 
+     * @param k
+     * @return size_t
+     */
+    size_t select(size_t k) const {
+        if(k >= count()) throw std::out_of_range("There are not so many set bits");
+        // last block whose rank is not greater than k, it lies between the blocks of the samples around k
+        size_t sample = k / selectSample;
+        size_t low = m_selectSamples[sample];
+        size_t high = sample + 1 < m_selectSamples.size() ? m_selectSamples[sample + 1] + 1 : m_blockRanks.size() - 1;
+        while(high - low > 1) {
+            size_t mid = low + (high - low) / 2;
+            if(m_blockRanks[mid] <= k) low = mid;
+            else high = mid;
+        }
+        k -= m_blockRanks[low];
+        for (size_t word = low * blockWords;; word++)
+        {
+            size_t bits = __builtin_popcountll(m_words[word]);
+            if(k < bits) return word * 64 + bitSelectInWord(m_words[word], k);
+            k -= bits;
+        }
+    }
+};
+
+} // namespace TAS
@@ -0,0 +1,451 @@
+/**
+ * @file Encoding.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains Base64 and hex encoding/decoding into String
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <String.hpp>
+
+#include <stdint.h>
+#include <stdexcept>
+#include <string>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace TAS
+{
+
+static const char base64Alphabet[]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+
+/**
+ * @brief amount of characters produced by encodeBase64 for n bytes
+ * 
+ * @param n
+ * @return size_t
+ */
+inline size_t base64EncodedSize(size_t n) {
+    return (n + 2) / 3 * 4;
+}
+
+/**
+ * @brief amount of characters produced by encodeHex for n bytes
+ * 
+ * @param n
+ * @return size_t
+ */
+inline size_t hexEncodedSize(size_t n) {
+    return n * 2;
+}
+
+/**
+ * @brief 6 bit value of Base64 character, 0xFF for characters outside of the alphabet
+ * 
+ * @param c
+ * @return uint8_t
+ */
+inline uint8_t base64Value(char c) {
+    if(c >= 'A' && c <= 'Z') return c - 'A';
+    if(c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if(c >= '0' && c <= '9') return c - '0' + 52;
+    if(c == '+') return 62;
+    if(c == '/') return 63;
+    return 0xFF;
+}
+
+/**
+ * @brief 4 bit value of hex character (both cases), 0xFF for other characters
+ * 
+ * @param c
+ * @return uint8_t
+ */
+inline uint8_t hexValue(char c) {
+    if(c >= '0' && c <= '9') return c - '0';
+    if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return 0xFF;
+}
+
+inline void throwDecodeError(char const *encoding, char const *what, size_t index) {
+    throw std::invalid_argument(std::string(encoding) + ": " + what + " at index " + std::to_string(index));
+}
+
+#ifdef __AVX2__
+
+/**
+ * @brief encodes 24 bytes from src into 32 characters (Mula-Lemire), reads 28 bytes from src
+ * 
+ */
+inline void base64EncodeBlockAvx2(uint8_t const *src, char *dst) {
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src))),
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + 12)), 1);
+
+    // every 3 bytes a, b, c become 32 bit word with bytes b, a, c, b
+    in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    __m256i indices = _mm256_or_si256(t1, t3);
+
+    // 6 bit values to ASCII by adding per range offsets
+    __m256i offsets = _mm256_setr_epi8(
+        65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+        65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    range = _mm256_sub_epi8(range, _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)));
+    __m256i out = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), out);
+}
+
+/**
+ * @brief decodes 32 characters from src into 24 bytes, returns false if src contains non-alphabet characters
+ * 
+ */
+inline bool base64DecodeBlockAvx2(char const *src, uint8_t *dst) {
+    __m256i str = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+
+    __m256i lutLo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    __m256i lutHi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    __m256i lutRoll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m256i mask2F = _mm256_set1_epi8(0x2F);
+
+    __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask2F);
+    __m256i loNibbles = _mm256_and_si256(str, mask2F);
+    __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+    __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+    if(!_mm256_testz_si256(lo, hi)) return false;
+
+    __m256i eq2F = _mm256_cmpeq_epi8(str, mask2F);
+    __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, hiNibbles));
+    __m256i values = _mm256_add_epi8(str, roll);
+
+    // packs four 6 bit values into 3 bytes
+    __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+    merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_castsi256_si128(merged));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + 16), _mm256_extracti128_si256(merged, 1));
+    return true;
+}
+
+/**
+ * @brief encodes 16 bytes from src into 32 characters
+ * 
+ */
+inline void hexEncodeBlockAvx2(uint8_t const *src, char *dst, bool upperCase) {
+    __m256i bytes = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src)));
+    // high nibble goes to the first character of the pair, low nibble to the second
+    __m256i nibbles = _mm256_or_si256(_mm256_srli_epi16(bytes, 4),
+        _mm256_slli_epi16(_mm256_and_si256(bytes, _mm256_set1_epi16(0x0F)), 8));
+    __m256i digits = upperCase ?
+        _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+                         '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F') :
+        _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+                         '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_shuffle_epi8(digits, nibbles));
+}
+
+/**
+ * @brief decodes 32 characters from src into 16 bytes, returns false if src contains non-hex characters
+ * 
+ */
+inline bool hexDecodeBlockAvx2(char const *src, uint8_t *dst) {
+    __m256i str = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+
+    __m256i digit = _mm256_sub_epi8(str, _mm256_set1_epi8('0'));
+    __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(str, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i isAlpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+    if(_mm256_movemask_epi8(_mm256_or_si256(isDigit, isAlpha)) != -1) return false;
+
+    __m256i values = _mm256_blendv_epi8(_mm256_add_epi8(alpha, _mm256_set1_epi8(10)), digit, isDigit);
+    __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(pairs, pairs), 0x08);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_castsi256_si128(packed));
+    return true;
+}
+
+#endif
+
+/**
+ * @brief encodes n bytes from src into base64EncodedSize(n) characters at dst (with '=' padding)
+ * 
+ * @param src
+ * @param n
+ * @param dst
+ */
+inline void base64Encode(uint8_t const *src, size_t n, char *dst) {
+    size_t i{};
+#ifdef __AVX2__
+    for (; i + 28 <= n; i += 24, dst += 32)
+    {
+        base64EncodeBlockAvx2(src + i, dst);
+    }
+#endif
+    for (; i + 3 <= n; i += 3, dst += 4)
+    {
+        uint32_t triple = (uint32_t(src[i]) << 16) | (uint32_t(src[i + 1]) << 8) | src[i + 2];
+        dst[0] = base64Alphabet[(triple >> 18) & 0x3F];
+        dst[1] = base64Alphabet[(triple >> 12) & 0x3F];
+        dst[2] = base64Alphabet[(triple >> 6) & 0x3F];
+        dst[3] = base64Alphabet[triple & 0x3F];
+    }
+    if(i < n) {
+        uint32_t triple = uint32_t(src[i]) << 16;
+        if(i + 1 < n) triple |= uint32_t(src[i + 1]) << 8;
+        dst[0] = base64Alphabet[(triple >> 18) & 0x3F];
+        dst[1] = base64Alphabet[(triple >> 12) & 0x3F];
+        dst[2] = (i + 1 < n) ? base64Alphabet[(triple >> 6) & 0x3F] : '=';
+        dst[3] = '=';
+    }
+}
+
+/**
+ * @brief strictly decodes n Base64 characters (padded, canonical) from src into dst
+ * throws std::invalid_argument with the index of the first offending character
+ * 
+ * @param src
+ * @param n
+ * @param dst must have room for n / 4 * 3 bytes
+ * @return size_t amount of decoded bytes
+ */
+inline size_t base64Decode(char const *src, size_t n, uint8_t *dst) {
+    if(n % 4 != 0) throwDecodeError("Base64", "length is not a multiple of 4", n);
+
+    size_t i{};
+    uint8_t *out = dst;
+#ifdef __AVX2__
+    // the last quartet (which may be padded) is always left to the scalar loop
+    for (; i + 36 <= n; i += 32, out += 24)
+    {
+        if(!base64DecodeBlockAvx2(src + i, out)) break;
+    }
+#endif
+    for (; i < n; i += 4)
+    {
+        uint8_t a = base64Value(src[i]);
+        uint8_t b = base64Value(src[i + 1]);
+        uint8_t c = base64Value(src[i + 2]);
+        uint8_t d = base64Value(src[i + 3]);
+        if(((a | b | c | d) & 0xC0) == 0) {
+            uint32_t quad = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | d;
+            *out++ = quad >> 16;
+            *out++ = quad >> 8;
+            *out++ = quad;
+            continue;
+        }
+
+        if(a == 0xFF) throwDecodeError("Base64", "invalid character", i);
+        if(b == 0xFF) throwDecodeError("Base64", "invalid character", i + 1);
+        bool last = i + 4 == n;
+        if(c == 0xFF && !(last && src[i + 2] == '=' && src[i + 3] == '=')) {
+            throwDecodeError("Base64", src[i + 2] == '=' && last ? "bad padding" : "invalid character", i + 2);
+        }
+        if(d == 0xFF && !(last && src[i + 3] == '=')) {
+            throwDecodeError("Base64", "invalid character", i + 3);
+        }
+
+        if(c == 0xFF) {
+            if(b & 0x0F) throwDecodeError("Base64", "non-zero padding bits", i + 1);
+            *out++ = (a << 2) | (b >> 4);
+        } else {
+            if(c & 0x03) throwDecodeError("Base64", "non-zero padding bits", i + 2);
+            *out++ = (a << 2) | (b >> 4);
+            *out++ = (b << 4) | (c >> 2);
+        }
+    }
+    return out - dst;
+}
+
+/**
+ * @brief encodes n bytes from src into 2 * n hex characters at dst
+ * 
+ * @param src
+ * @param n
+ * @param dst
+ * @param upperCase
+ */
+inline void hexEncode(uint8_t const *src, size_t n, char *dst, bool upperCase = false) {
+    char const *digits = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+    size_t i{};
+#ifdef __AVX2__
+    for (; i + 16 <= n; i += 16)
+    {
+        hexEncodeBlockAvx2(src + i, dst + 2 * i, upperCase);
+    }
+#endif
+    for (; i < n; i++)
+    {
+        dst[2 * i] = digits[src[i] >> 4];
+        dst[2 * i + 1] = digits[src[i] & 0x0F];
+    }
+}
+
+/**
+ * @brief strictly decodes n hex characters (any case) from src into n / 2 bytes at dst
+ * throws std::invalid_argument with the index of the first offending character
+ * 
+ * @param src
+ * @param n
+ * @param dst
+ */
+inline void hexDecode(char const *src, size_t n, uint8_t *dst) {
+    if(n % 2 != 0) throwDecodeError("Hex", "length is not even", n);
+
+    size_t i{};
+#ifdef __AVX2__
+    for (; i + 32 <= n; i += 32)
+    {
+        if(!hexDecodeBlockAvx2(src + i, dst + i / 2)) break;
+    }
+#endif
+    for (; i < n; i += 2)
+    {
+        uint8_t hi = hexValue(src[i]);
+        uint8_t lo = hexValue(src[i + 1]);
+        if(hi == 0xFF) throwDecodeError("Hex", "invalid character", i);
+        if(lo == 0xFF) throwDecodeError("Hex", "invalid character", i + 1);
+        dst[i / 2] = (hi << 4) | lo;
+    }
+}
+
+/**
+ * @brief appends Base64 encoding of n bytes from data to out, data may point into out
+ * 
+ * @param data
+ * @param n
+ * @param out
+ * @return BasicString<char, BlockSize>&
+ */
+template<size_t BlockSize>
+BasicString<char, BlockSize> &encodeBase64(void const *data, size_t n, BasicString<char, BlockSize> &out) {
+    if(n && out.isInside(static_cast<char const *>(data))) {
+        // data lies in out, which the resize below may reallocate, so it is encoded from a copy
+        BasicString<char, BlockSize> source(out);
+        return encodeBase64(source.cString() + (static_cast<char const *>(data) - out.cString()), n, out);
+    }
+    size_t offset = out.size();
+    out.resize(offset + base64EncodedSize(n));
+    base64Encode(static_cast<uint8_t const *>(data), n, out.data() + offset);
+    return out;
+}
+
+template<size_t BlockSize>
+BasicString<char, BlockSize> &encodeBase64(BasicString<char, BlockSize> const &data, BasicString<char, BlockSize> &out) {
+    return encodeBase64(data.cString(), data.size(), out);
+}
+
+/**
+ * @brief appends bytes decoded from n Base64 characters to out, str may point into out
+ * if str is not valid padded Base64 throws std::invalid_argument and leaves out unchanged
+ * 
+ * @param str
+ * @param n
+ * @param out
+ * @return BasicString<char, BlockSize>&
+ */
+template<size_t BlockSize>
+BasicString<char, BlockSize> &decodeBase64(char const *str, size_t n, BasicString<char, BlockSize> &out) {
+    if(n && out.isInside(str)) {
+        // str lies in out, which the resize below may reallocate, so it is decoded from a copy
+        BasicString<char, BlockSize> source(out);
+        return decodeBase64(source.cString() + (str - out.cString()), n, out);
+    }
+    size_t offset = out.size();
+    out.resize(offset + n / 4 * 3);
+    try {
+        size_t decoded = base64Decode(str, n, reinterpret_cast<uint8_t *>(out.data() + offset));
+        out.resize(offset + decoded);
+    } catch(...) {
+        out.resize(offset);
+        throw;
+    }
+    return out;
+}
+
+template<size_t BlockSize>
+BasicString<char, BlockSize> &decodeBase64(BasicString<char, BlockSize> const &str, BasicString<char, BlockSize> &out) {
+    return decodeBase64(str.cString(), str.size(), out);
+}
+
+/**
+ * @brief appends hex encoding of n bytes from data to out, data may point into out
+ * 
+ * @param data
+ * @param n
+ * @param out
+ * @param upperCase
+ * @return BasicString<char, BlockSize>&
+ */
+template<size_t BlockSize>
+BasicString<char, BlockSize> &encodeHex(void const *data, size_t n, BasicString<char, BlockSize> &out, bool upperCase = false) {
+    if(n && out.isInside(static_cast<char const *>(data))) {
+        // data lies in out, which the resize below may reallocate, so it is encoded from a copy
+        BasicString<char, BlockSize> source(out);
+        return encodeHex(source.cString() + (static_cast<char const *>(data) - out.cString()), n, out, upperCase);
+    }
+    size_t offset = out.size();
+    out.resize(offset + hexEncodedSize(n));
+    hexEncode(static_cast<uint8_t const *>(data), n, out.data() + offset, upperCase);
+    return out;
+}
+
+template<size_t BlockSize>
+BasicString<char, BlockSize> &encodeHex(BasicString<char, BlockSize> const &data, BasicString<char, BlockSize> &out, bool upperCase = false) {
+    return encodeHex(data.cString(), data.size(), out, upperCase);
+}
+
+/**
+ * @brief appends bytes decoded from n hex characters to out, str may point into out
+ * if str is not valid hex throws std::invalid_argument and leaves out unchanged
+ * 
+ * @param str
+ * @param n
+ * @param out
+ * @return BasicString<char, BlockSize>&
+ */
+template<size_t BlockSize>
+BasicString<char, BlockSize> &decodeHex(char const *str, size_t n, BasicString<char, BlockSize> &out) {
+    if(n && out.isInside(str)) {
+        // str lies in out, which the resize below may reallocate, so it is decoded from a copy
+        BasicString<char, BlockSize> source(out);
+        return decodeHex(source.cString() + (str - out.cString()), n, out);
+    }
+    size_t offset = out.size();
+    out.resize(offset + n / 2);
+    try {
+        hexDecode(str, n, reinterpret_cast<uint8_t *>(out.data() + offset));
+    } catch(...) {
+        out.resize(offset);
+        throw;
+    }
+    return out;
+}
+
+template<size_t BlockSize>
+BasicString<char, BlockSize> &decodeHex(BasicString<char, BlockSize> const &str, BasicString<char, BlockSize> &out) {
+    return decodeHex(str.cString(), str.size(), out);
+}
+
+} // namespace TAS
@@ -0,0 +1,127 @@
+/**
+ * @file EytzingerArray.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the EytzingerArray class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+
+#include <stdexcept>
+
+namespace TAS
+{
+
+/**
+ * @brief read only copy of a sorted Array laid out in BFS order of the implicit binary search tree
+ * (children of node k are 2k and 2k + 1). The first levels of the tree stay in cache and the
+ * descendants a few levels down share one cache line, so it is prefetched while the search descends
+ * 
+ * @tparam T type
+ * @tparam Size size
+ */
+template<typename T, size_t Size>
+class EytzingerArray {
+    static const size_t lineSize{64};
+    static const size_t lineElements{sizeof(T) < lineSize ? lineSize / sizeof(T) : 1};
+
+    // node k is m_data[k], m_data[0] is unused
+    alignas(lineSize) T m_data[Size + 1]{};
+
+    /**
+     * @brief node of the first element for which goRight is false, 0 if there is none
+     * 
+     */
+    template<typename GoRight>
+    size_t descend(GoRight const &goRight) const {
+        size_t k = 1;
+        while(k <= Size) {
+            if(k * lineElements <= Size) __builtin_prefetch(m_data + k * lineElements);
+            k = 2 * k + goRight(m_data[k]);
+        }
+        // the answer is where the path turned left for the last time
+        return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+    }
+
+    static size_t depth(size_t k) {
+        return 63 - __builtin_clzll(static_cast<unsigned long long>(k));
+    }
+
+    /**
+     * @brief position of node k in the sorted Array, computed instead of loaded from a table.
+     * In a perfect tree with the levels of this one, node k at depth d is the in-order
+     * ((2 * (k - 2^d) + 1) << (levels - 1 - d)) - 1, minus the absent leaves that would come before it
+     * 
+     */
+    static size_t rank(size_t k) {
+        size_t levels = depth(Size) + 1;
+        size_t d = depth(k);
+        size_t perfect = ((2 * (k - (size_t(1) << d)) + 1) << (levels - 1 - d)) - 1;
+        size_t presentLeaves = Size - ((size_t(1) << (levels - 1)) - 1);
+        size_t leavesBefore = (perfect + 1) / 2;
+        return perfect - (leavesBefore > presentLeaves ? leavesBefore - presentLeaves : 0);
+    }
+
+    /**
+     * @brief fills the subtree of node k in order (which is sorted order) starting with sorted[next]
+     * 
+     * @return size_t next element of sorted after the subtree
+     */
+    size_t build(Array<T, Size> const &sorted, size_t next, size_t k) {
+        if(k > Size) return next;
+        next = build(sorted, next, 2 * k);
+        m_data[k] = sorted[next++];
+        return build(sorted, next, 2 * k + 1);
+    }
+
+public:
+    /**
+     * @brief Construct a new Eytzinger Array object from sorted
+     * if sorted is not sorted throws std::invalid_argument
+     * 
+     * @param sorted
+     */
+    explicit EytzingerArray(Array<T, Size> const &sorted) {
+        if(!sorted.isSorted()) throw std::invalid_argument("Array is not sorted");
+        build(sorted, 0, 1);
+    }
+
+    size_t size() const {
+        return Size;
+    }
+
+    /**
+     * @brief index in the sorted Array of the first element not less than val, Size if there is none
+     * 
+     * @param val
+     * @return size_t
+     */
+    size_t lowerBound(T const &val) const {
+        size_t k = descend([&val](T const &x) { return x < val; });
+        return k ? rank(k) : Size;
+    }
+
+    /**
+     * @brief index in the sorted Array of the first element greater than val, Size if there is none
+     * 
+     * @param val
+     * @return size_t
+     */
+    size_t upperBound(T const &val) const {
+        size_t k = descend([&val](T const &x) { return !(val < x); });
+        return k ? rank(k) : Size;
+    }
+
+    bool contains(T const &val) const {
+        size_t k = descend([&val](T const &x) { return x < val; });
+        return k && !(val < m_data[k]);
+    }
+};
+
+} // namespace TAS
@@ -0,0 +1,762 @@
+/**
+ * @file HashMap.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the HashMap class and the Hash traits
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <String.hpp>
+#include <Vector.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace TAS
+{
+
+/**
+ * @brief finalizer of MurmurHash3, every input bit affects every output bit
+ * 
+ * @param x
+ * @return uint64_t
+ */
+inline uint64_t hashMix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * @brief hash of n bytes, consumed 8 at a time
+ * 
+ * @param data
+ * @param n
+ * @return uint64_t
+ */
+inline uint64_t hashBytes(void const *data, size_t n) {
+    unsigned char const *bytes = static_cast<unsigned char const *>(data);
+    uint64_t res = 0x9E3779B97F4A7C15ull ^ (n * 0xC2B2AE3D27D4EB4Full);
+    for (; n >= 8; bytes += 8, n -= 8)
+    {
+        uint64_t word;
+        memcpy(&word, bytes, 8);
+        res ^= word * 0x87C37B91114253D5ull;
+        res = ((res << 31) | (res >> 33)) * 0x4CF5AD432745937Full;
+    }
+    if(n) {
+        uint64_t word{};
+        memcpy(&word, bytes, n);
+        res ^= word * 0x87C37B91114253D5ull;
+    }
+    return hashMix(res);
+}
+
+/**
+ * @brief hashing of HashMap keys. Lookup is the type keys are searched by, keys convert to it implicitly
+ * and key(lookup) builds a key only when one is inserted, so string keys can be found by a BasicStringRef
+ * or a C string without allocating. Specialize for own key types
+ * 
+ * @tparam T key type, integers, enums and pointers are supported here
+ */
+template<typename T>
+struct Hash {
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value,
+        "TAS::Hash has to be specialized for this key type");
+
+    typedef T Lookup;
+
+    static uint64_t hash(T key) {
+        uint64_t bits{};
+        memcpy(&bits, &key, sizeof(T));
+        return hashMix(bits);
+    }
+
+    static bool equal(T const &key, T lookup) {
+        return key == lookup;
+    }
+
+    static T key(T lookup) {
+        return lookup;
+    }
+};
+
+template<typename CharType, size_t BlockSize>
+struct Hash<BasicString<CharType, BlockSize>> {
+    typedef BasicStringRef<CharType> Lookup;
+
+    static uint64_t hash(Lookup key) {
+        return hashBytes(key.data(), key.size() * sizeof(CharType));
+    }
+
+    static bool equal(BasicString<CharType, BlockSize> const &key, Lookup lookup) {
+        return key.size() == lookup.size() && (lookup.empty() || memcmp(key.cString(), lookup.data(), lookup.size() * sizeof(CharType)) == 0);
+    }
+
+    static BasicString<CharType, BlockSize> key(Lookup lookup) {
+        BasicString<CharType, BlockSize> res(CharType{}, lookup.size());
+        memoryCopy(res.data(), lookup.data(), lookup.size());
+        return res;
+    }
+};
+
+template<typename CharType>
+struct Hash<BasicStringRef<CharType>> {
+    typedef BasicStringRef<CharType> Lookup;
+
+    static uint64_t hash(Lookup key) {
+        return hashBytes(key.data(), key.size() * sizeof(CharType));
+    }
+
+    static bool equal(Lookup key, Lookup lookup) {
+        return key.size() == lookup.size() && (lookup.empty() || memcmp(key.data(), lookup.data(), lookup.size() * sizeof(CharType)) == 0);
+    }
+
+    static Lookup key(Lookup lookup) {
+        return lookup;
+    }
+};
+
+/**
+ * @brief 16 control bytes of a HashMap compared at once. Bit i of a returned mask stands for byte i
+ * 
+ */
+struct HashGroup {
+    static constexpr size_t width = 16;
+
+#if defined(__SSE2__)
+    __m128i m_control;
+
+    explicit HashGroup(int8_t const *control) : m_control(_mm_loadu_si128(reinterpret_cast<__m128i const *>(control))) {}
+
+    uint32_t match(int8_t h2) const {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_control, _mm_set1_epi8(h2))));
+    }
+
+    /**
+     * @brief empty and deleted bytes are the only ones with the sign bit set
+     * 
+     */
+    uint32_t matchEmptyOrDeleted() const {
+        return static_cast<uint32_t>(_mm_movemask_epi8(m_control));
+    }
+#else
+    int8_t m_control[width];
+
+    explicit HashGroup(int8_t const *control) {
+        memcpy(m_control, control, width);
+    }
+
+    uint32_t match(int8_t h2) const {
+        uint32_t res{};
+        for (size_t i = 0; i < width; i++)
+        {
+            res |= static_cast<uint32_t>(m_control[i] == h2) << i;
+        }
+        return res;
+    }
+
+    uint32_t matchEmptyOrDeleted() const {
+        uint32_t res{};
+        for (size_t i = 0; i < width; i++)
+        {
+            res |= static_cast<uint32_t>(m_control[i] < 0) << i;
+        }
+        return res;
+    }
+#endif
+
+    uint32_t matchEmpty() const {
+        return match(-128);
+    }
+};
+
+/**
+ * @brief open addressing hash map in the layout of Swiss tables: next to the entries every slot has one
+ * control byte holding 7 bits of the key's hash (or empty / deleted), so a probe compares 16 slots with one
+ * vector compare and only touches entries whose control byte matches.
+ * Capacity is a power of two of at least 16 and the table grows when it is 7/8 full.
+ * WARNING: inserting may move entries, iterators and references are invalidated by it
+ * 
+ * @tparam K key type, with Hasher::hash, Hasher::equal and Hasher::key
+ * @tparam V value type
+ * @tparam Hasher
+ */
+template<typename K, typename V, typename Hasher = Hash<K>>
+class HashMap {
+public:
+    /**
+     * @brief key and value pair stored in the map, the key must not be modified
+     * 
+     */
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    /**
+     * @brief type keys are searched by, BasicStringRef for string keys
+     * 
+     */
+    typedef typename Hasher::Lookup Lookup;
+
+    /**
+     * @brief forward iterator over the entries in slot order
+     * 
+     * @tparam EntryType Entry or Entry const
+     */
+    template<typename EntryType>
+    class BasicIterator {
+        int8_t const *m_control;
+        EntryType *m_entry;
+        EntryType *m_end;
+
+        void skipFree() {
+            while(m_entry != m_end && *m_control < 0) {
+                m_control++;
+                m_entry++;
+            }
+        }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef EntryType value_type;
+        typedef ptrdiff_t difference_type;
+        typedef EntryType *pointer;
+        typedef EntryType &reference;
+
+        BasicIterator(int8_t const *control, EntryType *entry, EntryType *end) : m_control(control), m_entry(entry), m_end(end) {
+            skipFree();
+        }
+
+        EntryType &operator*() const {
+            return *m_entry;
+        }
+
+        EntryType *operator->() const {
+            return m_entry;
+        }
+
+        BasicIterator &operator++() {
+            m_control++;
+            m_entry++;
+            skipFree();
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator res = *this;
+            ++*this;
+            return res;
+        }
+
+        bool operator==(BasicIterator const &rhs) const {
+            return m_entry == rhs.m_entry;
+        }
+
+        bool operator!=(BasicIterator const &rhs) const {
+            return m_entry != rhs.m_entry;
+        }
+    };
+
+    typedef BasicIterator<Entry> Iterator;
+    typedef BasicIterator<Entry const> ConstIterator;
+
+private:
+    static constexpr int8_t emptyControl{-128};
+    static constexpr int8_t deletedControl{-2};
+
+    int8_t *m_control{nullptr};
+    Entry *m_entries{nullptr};
+    size_t m_capacity{};
+    size_t m_size{};
+    size_t m_growthLeft{};
+
+    static size_t maxLoad(size_t capacity) {
+        return capacity - capacity / 8;
+    }
+
+    /**
+     * @brief smallest capacity that holds n entries without growing
+     * 
+     */
+    static size_t capacityFor(size_t n) {
+        size_t res = HashGroup::width;
+        while(maxLoad(res) < n) res *= 2;
+        return res;
+    }
+
+    static size_t h1(uint64_t hash) {
+        return static_cast<size_t>(hash >> 7);
+    }
+
+    static int8_t h2(uint64_t hash) {
+        return static_cast<int8_t>(hash & 0x7F);
+    }
+
+    /**
+     * @brief sets the control byte of slot index and its copy behind the end,
+     * which lets a group starting at any slot be loaded without wrapping around
+     * 
+     */
+    void setControl(size_t index, int8_t control) {
+        m_control[index] = control;
+        if(index < HashGroup::width - 1) m_control[m_capacity + index] = control;
+    }
+
+    /**
+     * @brief slot of key, m_capacity if it is not in the map.
+     * Groups are probed quadratically, which visits every group when the capacity is a power of two
+     * 
+     */
+    size_t findIndex(Lookup const &key, uint64_t hash) const {
+        if(!m_size) return m_capacity;
+        size_t mask = m_capacity - 1;
+        size_t pos = h1(hash) & mask;
+        for (size_t step = HashGroup::width;; step += HashGroup::width)
+        {
+            HashGroup group(m_control + pos);
+            for (uint32_t matches = group.match(h2(hash)); matches; matches &= matches - 1)
+            {
+                size_t index = (pos + __builtin_ctz(matches)) & mask;
+                if(Hasher::equal(m_entries[index].key, key)) return index;
+            }
+            if(group.matchEmpty()) return m_capacity;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    /**
+     * @brief first empty or deleted slot on the probe sequence of hash
+     * 
+     */
+    size_t findFreeIndex(uint64_t hash) const {
+        size_t mask = m_capacity - 1;
+        size_t pos = h1(hash) & mask;
+        for (size_t step = HashGroup::width;; step += HashGroup::width)
+        {
+            uint32_t free = HashGroup(m_control + pos).matchEmptyOrDeleted();
+            if(free) return (pos + __builtin_ctz(free)) & mask;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    /**
+     * @brief moves all entries into a table of capacity slots, dropping deleted slots
+     * 
+     */
+    void resize(size_t capacity) {
+        int8_t *oldControl = m_control;
+        Entry *oldEntries = m_entries;
+        size_t oldCapacity = m_capacity;
+
+        m_entries = vectorAllocate<Entry>(capacity);
+        m_control = new int8_t[capacity + HashGroup::width - 1];
+        memset(m_control, emptyControl, capacity + HashGroup::width - 1);
+        m_capacity = capacity;
+        m_growthLeft = maxLoad(capacity) - m_size;
+
+        for (size_t i = 0; i < oldCapacity; i++)
+        {
+            if(oldControl[i] < 0) continue;
+            uint64_t hash = Hasher::hash(oldEntries[i].key);
+            size_t index = findFreeIndex(hash);
+            new (m_entries + index) Entry(std::move(oldEntries[i]));
+            oldEntries[i].~Entry();
+            setControl(index, h2(hash));
+        }
+        delete[] oldControl;
+        vectorDeallocate(oldEntries);
+    }
+
+    /**
+     * @brief free slot for a new entry of hash, m_capacity if the table is full and has to grow first
+     * 
+     */
+    size_t findInsertIndex(uint64_t hash) const {
+        if(!m_capacity) return m_capacity;
+        size_t index = findFreeIndex(hash);
+        if(!m_growthLeft && m_control[index] != deletedControl) return m_capacity;
+        return index;
+    }
+
+    /**
+     * @brief makes room for one more entry, grows the table or clears it from deleted slots
+     * 
+     */
+    void growForInsert() {
+        if(!m_capacity) {
+            resize(capacityFor(1));
+        } else {
+            // many deleted slots: rehashing in place frees them, otherwise the table doubles
+            resize(m_size < maxLoad(m_capacity) / 2 ? m_capacity : m_capacity * 2);
+        }
+    }
+
+    void destroyEntries() {
+        for (size_t i = 0; i < m_capacity; i++)
+        {
+            if(m_control[i] >= 0) m_entries[i].~Entry();
+        }
+    }
+
+public:
+    /**
+     * @brief Construct an empty Hash Map object, it allocates nothing until the first insert
+     * 
+     */
+    HashMap() = default;
+
+    /**
+     * @brief Construct a new Hash Map object with room for n entries
+     * 
+     * @param n
+     */
+    explicit HashMap(size_t n) {
+        reserve(n);
+    }
+
+    /**
+     * @brief Construct a new Hash Map object from std::initializer_list, later duplicates of a key are ignored
+     * 
+     * @param val
+     */
+    HashMap(std::initializer_list<Entry> const &val) {
+        reserve(val.size());
+        for (Entry const &entry : val) {
+            insert(entry.key, entry.value);
+        }
+    }
+
+    HashMap(HashMap const &other) {
+        if(!other.m_capacity) return;
+        m_entries = vectorAllocate<Entry>(other.m_capacity);
+        m_control = new int8_t[other.m_capacity + HashGroup::width - 1];
+        memcpy(m_control, other.m_control, other.m_capacity + HashGroup::width - 1);
+        m_capacity = other.m_capacity;
+        for (size_t i = 0; i < m_capacity; i++)
+        {
+            if(m_control[i] < 0) continue;
+            try {
+                new (m_entries + i) Entry(other.m_entries[i]);
+            } catch(...) {
+                for (size_t j = 0; j < i; j++)
+                {
+                    if(m_control[j] >= 0) m_entries[j].~Entry();
+                }
+                delete[] m_control;
+                vectorDeallocate(m_entries);
+                throw;
+            }
+        }
+        m_size = other.m_size;
+        m_growthLeft = other.m_growthLeft;
+    }
+
+    HashMap(HashMap &&other) noexcept {
+        swap(other);
+    }
+
+    ~HashMap() {
+        if(!m_capacity) return;
+        destroyEntries();
+        delete[] m_control;
+        vectorDeallocate(m_entries);
+    }
+
+    HashMap &operator=(HashMap other) {
+        swap(other);
+        return *this;
+    }
+
+    HashMap &swap(HashMap &other) noexcept {
+        std::swap(m_control, other.m_control);
+        std::swap(m_entries, other.m_entries);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_size, other.m_size);
+        std::swap(m_growthLeft, other.m_growthLeft);
+        return *this;
+    }
+
+    /**
+     * @brief makes room for n entries, so inserting them does not rehash
+     * 
+     * @param n
+     */
+    HashMap &reserve(size_t n) {
+        if(capacityFor(n) > m_capacity) resize(capacityFor(n));
+        return *this;
+    }
+
+    /**
+     * @brief rebuilds the table with at least capacity slots (rounded up to a power of two, never less than
+     * the entries need), dropping deleted slots. rehash(0) shrinks the table to fit
+     * 
+     * @param capacity
+     */
+    HashMap &rehash(size_t capacity) {
+        size_t res = capacityFor(m_size);
+        while(res < capacity) res *= 2;
+        if(!m_size && !capacity) {
+            HashMap().swap(*this);
+        } else {
+            resize(res);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief constructs the entry of key from args, nothing happens if key is already present.
+     * The key itself is only built when the entry is inserted. key and args may refer into the map
+     * 
+     * @param key
+     * @return std::pair<Iterator, bool> entry of key and whether it was inserted
+     */
+    template<typename... Args>
+    std::pair<Iterator, bool> tryEmplace(Lookup const &key, Args &&...args) {
+        uint64_t hash = Hasher::hash(key);
+        size_t index = findIndex(key, hash);
+        if(index != m_capacity) return {iteratorAt(index), false};
+        index = findInsertIndex(hash);
+        if(index == m_capacity) {
+            // key and args may refer into the table, so the entry is built before the table moves
+            Entry entry{Hasher::key(key), V(std::forward<Args>(args)...)};
+            growForInsert();
+            index = findFreeIndex(hash);
+            new (m_entries + index) Entry(std::move(entry));
+        } else {
+            new (m_entries + index) Entry{Hasher::key(key), V(std::forward<Args>(args)...)};
+        }
+        if(m_control[index] == emptyControl) m_growthLeft--;
+        setControl(index, h2(hash));
+        m_size++;
+        return {iteratorAt(index), true};
+    }
+
+    /**
+     * @brief inserts key with value unless key is already present
+     * 
+     * @return std::pair<Iterator, bool> entry of key and whether it was inserted
+     */
+    std::pair<Iterator, bool> insert(Lookup const &key, V const &value) {
+        return tryEmplace(key, value);
+    }
+
+    /**
+     * @brief inserts key with value or assigns value to the present entry
+     * 
+     * @return std::pair<Iterator, bool> entry of key and whether it was inserted
+     */
+    std::pair<Iterator, bool> insertOrAssign(Lookup const &key, V const &value) {
+        std::pair<Iterator, bool> res = tryEmplace(key, value);
+        if(!res.second) res.first->value = value;
+        return res;
+    }
+
+    /**
+     * @brief value of key, a value initialized one is inserted if key is not present
+     * 
+     * @param key
+     * @return V&
+     */
+    V &operator[](Lookup const &key) {
+        return tryEmplace(key).first->value;
+    }
+
+    /**
+     * @brief if key is not present throws std::out_of_range
+     * 
+     * @param key
+     * @return V&
+     */
+    V &at(Lookup const &key) {
+        size_t index = findIndex(key, Hasher::hash(key));
+        if(index == m_capacity) throw std::out_of_range("Key is not in the map");
+        return m_entries[index].value;
+    }
+
+    /**
+     * @brief if key is not present throws std::out_of_range
+     * 
+     * @param key
+     * @return V const&
+     */
+    V const &at(Lookup const &key) const {
+        size_t index = findIndex(key, Hasher::hash(key));
+        if(index == m_capacity) throw std::out_of_range("Key is not in the map");
+        return m_entries[index].value;
+    }
+
+    /**
+     * @brief entry of key, end() if it is not present
+     * 
+     * @param key
+     * @return Iterator
+     */
+    Iterator find(Lookup const &key) {
+        size_t index = findIndex(key, Hasher::hash(key));
+        return index == m_capacity ? end() : iteratorAt(index);
+    }
+
+    ConstIterator find(Lookup const &key) const {
+        size_t index = findIndex(key, Hasher::hash(key));
+        return index == m_capacity ? end() : iteratorAt(index);
+    }
+
+    bool contains(Lookup const &key) const {
+        return findIndex(key, Hasher::hash(key)) != m_capacity;
+    }
+
+    /**
+     * @brief removes the entry of key. The slot is marked deleted only if a probe might have passed it,
+     * that is if it lies in a run of 16 or more used slots
+     * 
+     * @param key
+     * @return true if an entry was removed
+     */
+    bool erase(Lookup const &key) {
+        size_t index = findIndex(key, Hasher::hash(key));
+        if(index == m_capacity) return false;
+        m_entries[index].~Entry();
+        m_size--;
+        size_t mask = m_capacity - 1;
+        uint32_t emptyAfter = HashGroup(m_control + index).matchEmpty();
+        uint32_t emptyBefore = HashGroup(m_control + ((index - HashGroup::width) & mask)).matchEmpty();
+        if(emptyAfter && emptyBefore && static_cast<size_t>(__builtin_ctz(emptyAfter) + __builtin_clz(emptyBefore << 16)) < HashGroup::width) {
+            setControl(index, emptyControl);
+            m_growthLeft++;
+        } else {
+            setControl(index, deletedControl);
+        }
+        return true;
+    }
+
+    /**
+     * @brief removes all entries and keeps the capacity
+     * 
+     */
+    HashMap &clear() {
+        if(!m_capacity) return *this;
+        destroyEntries();
+        memset(m_control, emptyControl, m_capacity + HashGroup::width - 1);
+        m_size = 0;
+        m_growthLeft = maxLoad(m_capacity);
+        return *this;
+    }
+
+    bool empty() const {
+        return !m_size;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief amount of slots
+     * 
+     * @return size_t
+     */
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    Iterator begin() {
+        return Iterator(m_control, m_entries, m_entries + m_capacity);
+    }
+
+    ConstIterator begin() const {
+        return ConstIterator(m_control, m_entries, m_entries + m_capacity);
+    }
+
+    ConstIterator cbegin() const {
+        return begin();
+    }
+
+    Iterator end() {
+        return Iterator(nullptr, m_entries + m_capacity, m_entries + m_capacity);
+    }
+
+    ConstIterator end() const {
+        return ConstIterator(nullptr, m_entries + m_capacity, m_entries + m_capacity);
+    }
+
+    ConstIterator cend() const {
+        return end();
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the map
+     * 
+     * @tparam Function callable as void(K const &, V const &)
+     * @param f
+     */
+    template<typename Function>
+    HashMap const &forEach(Function &&f) const {
+        for (size_t i = 0; i < m_capacity; i++)
+        {
+            if(m_control[i] >= 0) f(m_entries[i].key, static_cast<V const &>(m_entries[i].value));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the values
+     * 
+     * @tparam Function callable as void(K const &, V &)
+     * @param f
+     */
+    template<typename Function>
+    HashMap &transformReference(Function &&f) {
+        for (size_t i = 0; i < m_capacity; i++)
+        {
+            if(m_control[i] >= 0) f(static_cast<K const &>(m_entries[i].key), m_entries[i].value);
+        }
+        return *this;
+    }
+
+    bool operator==(HashMap const &rhs) const {
+        if(m_size != rhs.m_size) return false;
+        for (size_t i = 0; i < m_capacity; i++)
+        {
+            if(m_control[i] < 0) continue;
+            size_t index = rhs.findIndex(m_entries[i].key, Hasher::hash(m_entries[i].key));
+            if(index == rhs.m_capacity || !(rhs.m_entries[index].value == m_entries[i].value)) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(HashMap const &rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    Iterator iteratorAt(size_t index) {
+        return Iterator(m_control + index, m_entries + index, m_entries + m_capacity);
+    }
+
+    ConstIterator iteratorAt(size_t index) const {
+        return ConstIterator(m_control + index, m_entries + index, m_entries + m_capacity);
+    }
+};
+
+} // namespace TAS
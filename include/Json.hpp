@@ -0,0 +1,300 @@
+/**
+ * @file Json.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains JSON string escaping and unescaping into String
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <String.hpp>
+
+#include <stdint.h>
+#include <stdexcept>
+#include <string>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace TAS
+{
+
+/**
+ * @brief replacement of every byte for escapeWithTable, nullptr means the byte is copied as is
+ * 
+ */
+typedef Array<char const *, 256> EscapeTable;
+
+/**
+ * @brief escape table of JSON strings: quote, backslash and control characters
+ * 
+ * @return EscapeTable const&
+ */
+inline EscapeTable const &jsonEscapeTable() {
+    static const EscapeTable table = []() {
+        static char unicodeEscapes[0x20][7];
+        EscapeTable res(nullptr);
+        for (size_t c = 0; c < 0x20; c++)
+        {
+            char *escape = unicodeEscapes[c];
+            escape[0] = '\\';
+            escape[1] = 'u';
+            escape[2] = '0';
+            escape[3] = '0';
+            escape[4] = "0123456789abcdef"[c >> 4];
+            escape[5] = "0123456789abcdef"[c & 0x0F];
+            escape[6] = '\0';
+            res[c] = escape;
+        }
+        res['\b'] = "\\b";
+        res['\f'] = "\\f";
+        res['\n'] = "\\n";
+        res['\r'] = "\\r";
+        res['\t'] = "\\t";
+        res['"'] = "\\\"";
+        res['\\'] = "\\\\";
+        return res;
+    }();
+    return table;
+}
+
+/**
+ * @brief index of the first quote, backslash or control character in [str + from, str + n), n if there is none
+ * 
+ * @param str
+ * @param from
+ * @param n
+ * @return size_t
+ */
+inline size_t jsonSpecialScan(char const *str, size_t from, size_t n) {
+    size_t i = from;
+#if defined(__AVX2__)
+    __m256i quote = _mm256_set1_epi8('"');
+    __m256i backslash = _mm256_set1_epi8('\\');
+    __m256i control = _mm256_set1_epi8(0x1F);
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + i));
+        __m256i special = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)),
+            _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, control), chunk));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+        if(mask) return i + __builtin_ctz(mask);
+    }
+#elif defined(__SSE2__)
+    __m128i quote = _mm_set1_epi8('"');
+    __m128i backslash = _mm_set1_epi8('\\');
+    __m128i control = _mm_set1_epi8(0x1F);
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + i));
+        __m128i special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+            _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+        if(mask) return i + __builtin_ctz(mask);
+    }
+#endif
+    for (; i < n; i++)
+    {
+        unsigned char c = static_cast<unsigned char>(str[i]);
+        if(c < 0x20 || c == '"' || c == '\\') return i;
+    }
+    return n;
+}
+
+/**
+ * @brief appends str to out replacing every byte that has an entry in table.
+ * runs of bytes without entries are copied at once, str may point into out
+ * 
+ * @param str
+ * @param n
+ * @param table
+ * @param out
+ * @return BasicString<char, BlockSize>&
+ */
+template<size_t BlockSize>
+BasicString<char, BlockSize> &escapeWithTable(char const *str, size_t n, EscapeTable const &table, BasicString<char, BlockSize> &out) {
+    if(n && out.isInside(str)) {
+        // str lies in out, which appending may reallocate, so it is read from a copy
+        BasicString<char, BlockSize> source(out);
+        return escapeWithTable(source.cString() + (str - out.cString()), n, table, out);
+    }
+    size_t run{};
+    for (size_t i = 0; i < n; i++)
+    {
+        char const *escape = table[static_cast<unsigned char>(str[i])];
+        if(!escape) continue;
+        out.append(str + run, i - run);
+        out.append(escape, cStringLength(escape));
+        run = i + 1;
+    }
+    return out.append(str + run, n - run);
+}
+
+template<size_t BlockSize>
+BasicString<char, BlockSize> &escapeWithTable(BasicString<char, BlockSize> const &str, EscapeTable const &table, BasicString<char, BlockSize> &out) {
+    return escapeWithTable(str.cString(), str.size(), table, out);
+}
+
+/**
+ * @brief appends str escaped as contents of a JSON string (without surrounding quotes) to out.
+ * Bytes >= 0x80 are copied as is, so UTF-8 stays UTF-8, str may point into out
+ * 
+ * @param str
+ * @param n
+ * @param out
+ * @return BasicString<char, BlockSize>&
+ */
+template<size_t BlockSize>
+BasicString<char, BlockSize> &escapeJson(char const *str, size_t n, BasicString<char, BlockSize> &out) {
+    if(n && out.isInside(str)) {
+        // str lies in out, which appending may reallocate, so it is read from a copy
+        BasicString<char, BlockSize> source(out);
+        return escapeJson(source.cString() + (str - out.cString()), n, out);
+    }
+    EscapeTable const &table = jsonEscapeTable();
+    size_t i{};
+    while(i < n) {
+        size_t special = jsonSpecialScan(str, i, n);
+        out.append(str + i, special - i);
+        if(special == n) break;
+        char const *escape = table[static_cast<unsigned char>(str[special])];
+        out.append(escape, cStringLength(escape));
+        i = special + 1;
+    }
+    return out;
+}
+
+template<size_t BlockSize>
+BasicString<char, BlockSize> &escapeJson(BasicString<char, BlockSize> const &str, BasicString<char, BlockSize> &out) {
+    return escapeJson(str.cString(), str.size(), out);
+}
+
+inline void throwJsonError(char const *what, size_t index) {
+    throw std::invalid_argument(std::string("JSON: ") + what + " at index " + std::to_string(index));
+}
+
+/**
+ * @brief value of 4 hex digits, throws std::invalid_argument if they are not hex
+ * 
+ */
+inline uint32_t jsonHex4(char const *str, size_t index) {
+    uint32_t res{};
+    for (size_t i = 0; i < 4; i++)
+    {
+        char c = str[index + i];
+        res <<= 4;
+        if(c >= '0' && c <= '9') res |= c - '0';
+        else if(c >= 'a' && c <= 'f') res |= c - 'a' + 10;
+        else if(c >= 'A' && c <= 'F') res |= c - 'A' + 10;
+        else throwJsonError("invalid \\u escape", index + i);
+    }
+    return res;
+}
+
+/**
+ * @brief appends code point encoded as UTF-8 to out
+ * 
+ */
+template<size_t BlockSize>
+void appendUtf8(uint32_t codePoint, BasicString<char, BlockSize> &out) {
+    char buf[4];
+    size_t n;
+    if(codePoint < 0x80) {
+        buf[0] = static_cast<char>(codePoint);
+        n = 1;
+    } else if(codePoint < 0x800) {
+        buf[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+        buf[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        n = 2;
+    } else if(codePoint < 0x10000) {
+        buf[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+        buf[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        buf[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        n = 3;
+    } else {
+        buf[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+        buf[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        buf[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        buf[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        n = 4;
+    }
+    out.append(buf, n);
+}
+
+/**
+ * @brief appends str, the contents of a JSON string (without surrounding quotes), unescaped to out.
+ * \\u escapes are written as UTF-8, surrogate pairs are combined.
+ * if str is not valid throws std::invalid_argument and leaves out unchanged, str may point into out
+ * 
+ * @param str
+ * @param n
+ * @param out
+ * @return BasicString<char, BlockSize>&
+ */
+template<size_t BlockSize>
+BasicString<char, BlockSize> &unescapeJson(char const *str, size_t n, BasicString<char, BlockSize> &out) {
+    if(n && out.isInside(str)) {
+        // str lies in out, which appending may reallocate, so it is read from a copy
+        BasicString<char, BlockSize> source(out);
+        return unescapeJson(source.cString() + (str - out.cString()), n, out);
+    }
+    size_t offset = out.size();
+    try {
+        size_t i{};
+        while(i < n) {
+            size_t special = jsonSpecialScan(str, i, n);
+            out.append(str + i, special - i);
+            if(special == n) break;
+            if(str[special] != '\\') throwJsonError("unescaped character", special);
+            if(special + 1 == n) throwJsonError("unterminated escape", special);
+
+            i = special + 2;
+            switch(str[special + 1]) {
+                case '"': out.append('"'); break;
+                case '\\': out.append('\\'); break;
+                case '/': out.append('/'); break;
+                case 'b': out.append('\b'); break;
+                case 'f': out.append('\f'); break;
+                case 'n': out.append('\n'); break;
+                case 'r': out.append('\r'); break;
+                case 't': out.append('\t'); break;
+                case 'u': {
+                    if(i + 4 > n) throwJsonError("truncated \\u escape", special);
+                    uint32_t codePoint = jsonHex4(str, i);
+                    i += 4;
+                    if(codePoint >= 0xDC00 && codePoint <= 0xDFFF) throwJsonError("unpaired low surrogate", special);
+                    if(codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                        if(i + 6 > n || str[i] != '\\' || str[i + 1] != 'u') throwJsonError("unpaired high surrogate", special);
+                        uint32_t low = jsonHex4(str, i + 2);
+                        if(low < 0xDC00 || low > 0xDFFF) throwJsonError("unpaired high surrogate", special);
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    }
+                    appendUtf8(codePoint, out);
+                    break;
+                }
+                default:
+                    throwJsonError("invalid escape", special);
+            }
+        }
+    } catch(...) {
+        out.resize(offset);
+        throw;
+    }
+    return out;
+}
+
+template<size_t BlockSize>
+BasicString<char, BlockSize> &unescapeJson(BasicString<char, BlockSize> const &str, BasicString<char, BlockSize> &out) {
+    return unescapeJson(str.cString(), str.size(), out);
+}
+
+} // namespace TAS
@@ -0,0 +1,208 @@
+/**
+ * @file LineIndex.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the LineIndex class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <String.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace TAS
+{
+
+/**
+ * @brief appends base + index + 1 of every '\n' in [text, text + n) to starts
+ * 
+ * @tparam CharType
+ * @param text
+ * @param n
+ * @param base
+ * @param starts
+ */
+template<typename CharType>
+void collectLineStarts(CharType const *text, size_t n, size_t base, std::vector<size_t> &starts) {
+    size_t i{};
+    if constexpr (sizeof(CharType) == 1) {
+#if defined(__AVX2__)
+        __m256i newline = _mm256_set1_epi8('\n');
+        for (; i + 32 <= n; i += 32)
+        {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(text + i));
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newline)));
+            for (; mask; mask &= mask - 1)
+            {
+                starts.push_back(base + i + __builtin_ctz(mask) + 1);
+            }
+        }
+#elif defined(__SSE2__)
+        __m128i newline = _mm_set1_epi8('\n');
+        for (; i + 16 <= n; i += 16)
+        {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(text + i));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)));
+            for (; mask; mask &= mask - 1)
+            {
+                starts.push_back(base + i + __builtin_ctz(mask) + 1);
+            }
+        }
+#endif
+    }
+    for (; i < n; i++)
+    {
+        if(text[i] == '\n') starts.push_back(base + i + 1);
+    }
+}
+
+/**
+ * @brief Index of line beginnings of a text, lines are separated by '\n'.
+ * Gives O(1) line -> offset and O(log n) offset -> line lookups.
+ * When the text grows (e.g. with BasicString::append) only the new characters are indexed
+ * 
+ * @tparam CharType type of the character
+ */
+template<typename CharType>
+class BasicLineIndex {
+    std::vector<size_t> m_lineStarts{0};
+    size_t m_textSize{};
+
+public:
+    BasicLineIndex() = default;
+
+    /**
+     * @brief Construct a new Line Index object over raw characters
+     * 
+     * @param text
+     * @param n
+     */
+    BasicLineIndex(CharType const *text, size_t n) {
+        extend(text, n);
+    }
+
+    /**
+     * @brief Construct a new Line Index object over string
+     * 
+     * @param text
+     */
+    template<size_t BlockSize>
+    BasicLineIndex(BasicString<CharType, BlockSize> const &text) {
+        extend(text.cString(), text.size());
+    }
+
+    /**
+     * @brief indexes n characters that were appended to the end of the indexed text
+     * 
+     * @param appended
+     * @param n
+     * @return BasicLineIndex&
+     */
+    BasicLineIndex &extend(CharType const *appended, size_t n) {
+        collectLineStarts(appended, n, m_textSize, m_lineStarts);
+        m_textSize += n;
+        return *this;
+    }
+
+    /**
+     * @brief indexes characters of text after textSize().
+     * WARNING: text must be the indexed text, only appended to since
+     * 
+     * @param text
+     * @return BasicLineIndex&
+     */
+    template<size_t BlockSize>
+    BasicLineIndex &update(BasicString<CharType, BlockSize> const &text) {
+        if(text.size() < m_textSize) throw std::out_of_range("Text is shorter than indexed");
+        return extend(text.cString() + m_textSize, text.size() - m_textSize);
+    }
+
+    /**
+     * @brief forgets everything, as if indexing an empty text
+     * 
+     * @return BasicLineIndex&
+     */
+    BasicLineIndex &clear() {
+        m_lineStarts.assign(1, 0);
+        m_textSize = 0;
+        return *this;
+    }
+
+    /**
+     * @brief amount of lines, a text without characters has one empty line
+     * 
+     * @return size_t
+     */
+    size_t lineCount() const {
+        return m_lineStarts.size();
+    }
+
+    /**
+     * @brief amount of indexed characters
+     * 
+     * @return size_t
+     */
+    size_t textSize() const {
+        return m_textSize;
+    }
+
+    /**
+     * @brief offset of the first character of line, O(1)
+     * if out of range throws std::out_of_range
+     * 
+     * @param line
+     * @return size_t
+     */
+    size_t lineOffset(size_t line) const {
+        if(line >= m_lineStarts.size()) throw std::out_of_range("Line is out of range");
+        return m_lineStarts[line];
+    }
+
+    /**
+     * @brief length of line without the '\n'
+     * if out of range throws std::out_of_range
+     * 
+     * @param line
+     * @return size_t
+     */
+    size_t lineLength(size_t line) const {
+        if(line >= m_lineStarts.size()) throw std::out_of_range("Line is out of range");
+        if(line + 1 == m_lineStarts.size()) return m_textSize - m_lineStarts[line];
+        return m_lineStarts[line + 1] - m_lineStarts[line] - 1;
+    }
+
+    /**
+     * @brief line that contains character at offset, O(log n).
+     * offset == textSize() belongs to the last line
+     * if out of range throws std::out_of_range
+     * 
+     * @param offset
+     * @return size_t
+     */
+    size_t lineOf(size_t offset) const {
+        if(offset > m_textSize) throw std::out_of_range("Offset is out of range");
+        return std::upper_bound(m_lineStarts.begin(), m_lineStarts.end(), offset) - m_lineStarts.begin() - 1;
+    }
+};
+
+//TYPEDEFS
+/**
+ * @brief Typedef of TAS::BasicLineIndex<char>
+ * 
+ */
+typedef BasicLineIndex<char> LineIndex;
+//TYPEDEFS
+
+} // namespace TAS
@@ -0,0 +1,672 @@
+/**
+ * @file MdArray.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the MdArray and MdView classes
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace TAS
+{
+
+/**
+ * @brief order of elements in memory. RowMajor: the last index is contiguous, ColumnMajor: the first index is contiguous
+ * 
+ */
+enum class Layout {
+    RowMajor,
+    ColumnMajor
+};
+
+/**
+ * @brief side of the square blocks transpose works on, one block row of T fills a cache line
+ * 
+ * @tparam T
+ * @return size_t
+ */
+template<typename T>
+constexpr size_t mdTransposeBlock() {
+    return sizeof(T) < 8 ? 64 / sizeof(T) : 8;
+}
+
+/**
+ * @brief non owning view of a Rank dimensional grid of T over memory like Array::data().
+ * Every dimension has an extent and a stride in elements, so slices and transposed views are views too
+ * 
+ * @tparam T type, const T for read only views
+ * @tparam Rank amount of dimensions
+ */
+template<typename T, size_t Rank>
+class MdView {
+    static_assert(Rank > 0, "MdView needs at least one dimension");
+
+    template<typename U, size_t R>
+    friend class MdView;
+
+    T *m_data{nullptr};
+    Array<size_t, Rank> m_extents;
+    Array<size_t, Rank> m_strides;
+
+    /**
+     * @brief calls f(element, index) for all elements, the dimension with the smallest stride is the innermost loop
+     * 
+     */
+    template<typename Function>
+    void visit(Function &&f) const {
+        if(size() == 0) return;
+
+        // dimensions from the largest to the smallest stride
+        Array<size_t, Rank> order;
+        order.transformReferenceWithIndex([](size_t &dim, size_t i) { dim = i; });
+        order.sort([this](size_t a, size_t b) { return m_strides[a] > m_strides[b]; });
+        size_t inner = order[Rank - 1];
+
+        Array<size_t, Rank> index;
+        while(true) {
+            T *base = m_data + offset(index);
+            for (size_t k = 0; k < m_extents[inner]; k++)
+            {
+                index[inner] = k;
+                f(base[k * m_strides[inner]], index);
+            }
+            index[inner] = 0;
+
+            size_t d = Rank - 1;
+            while(d > 0) {
+                size_t dim = order[d - 1];
+                if(++index[dim] < m_extents[dim]) break;
+                index[dim] = 0;
+                d--;
+            }
+            if(d == 0) return;
+        }
+    }
+
+    size_t offset(Array<size_t, Rank> const &index) const {
+        size_t res{};
+        for (size_t d = 0; d < Rank; d++)
+        {
+            res += index[d] * m_strides[d];
+        }
+        return res;
+    }
+
+public:
+    MdView() = default;
+
+    /**
+     * @brief Construct a new Md View object over densely packed elements
+     * 
+     * @param data first element
+     * @param extents size of every dimension
+     * @param layout
+     */
+    MdView(T *data, Array<size_t, Rank> const &extents, Layout layout = Layout::RowMajor) :
+        m_data(data),
+        m_extents(extents)
+    {
+        size_t stride = 1;
+        for (size_t i = 0; i < Rank; i++)
+        {
+            size_t d = layout == Layout::RowMajor ? Rank - 1 - i : i;
+            m_strides[d] = stride;
+            stride *= extents[d];
+        }
+    }
+
+    /**
+     * @brief Construct a new Md View object with explicit strides in elements
+     * 
+     * @param data first element
+     * @param extents size of every dimension
+     * @param strides distance between neighbours of every dimension
+     */
+    MdView(T *data, Array<size_t, Rank> const &extents, Array<size_t, Rank> const &strides) :
+        m_data(data),
+        m_extents(extents),
+        m_strides(strides)
+    {}
+
+    /**
+     * @brief read only view of a view
+     * 
+     */
+    template<typename U, typename = std::enable_if_t<std::is_same<T, U const>::value && !std::is_same<T, U>::value>>
+    MdView(MdView<U, Rank> const &view) :
+        m_data(view.m_data),
+        m_extents(view.m_extents),
+        m_strides(view.m_strides)
+    {}
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index one index per dimension
+     * @return T&
+     */
+    template<typename... Indices>
+    T &operator()(Indices... index) const {
+        static_assert(sizeof...(Indices) == Rank, "one index per dimension");
+        return m_data[offset(Array<size_t, Rank>{static_cast<size_t>(index)...})];
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index one index per dimension
+     * @return T&
+     */
+    template<typename... Indices>
+    T &at(Indices... index) const {
+        static_assert(sizeof...(Indices) == Rank, "one index per dimension");
+        Array<size_t, Rank> idx{static_cast<size_t>(index)...};
+        for (size_t d = 0; d < Rank; d++)
+        {
+            if(idx[d] >= m_extents[d]) throw std::out_of_range("Index is out of range");
+        }
+        return m_data[offset(idx)];
+    }
+
+    T *data() const {
+        return m_data;
+    }
+
+    static constexpr size_t rank() {
+        return Rank;
+    }
+
+    size_t extent(size_t dim) const {
+        return m_extents[dim];
+    }
+
+    size_t stride(size_t dim) const {
+        return m_strides[dim];
+    }
+
+    /**
+     * @brief amount of elements
+     * 
+     * @return size_t
+     */
+    size_t size() const {
+        size_t res = 1;
+        for (size_t d = 0; d < Rank; d++)
+        {
+            res *= m_extents[d];
+        }
+        return res;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief view of the indices first, first + step, ... below last of dimension dim.
+     * if the range is out of the extent or step is 0 throws std::out_of_range
+     * 
+     * @param dim
+     * @param first
+     * @param last
+     * @param step
+     * @return MdView
+     */
+    MdView slice(size_t dim, size_t first, size_t last, size_t step = 1) const {
+        if(dim >= Rank || first > last || last > m_extents[dim] || step == 0) throw std::out_of_range("Slice is out of range");
+        MdView res(*this);
+        res.m_data = m_data + first * m_strides[dim];
+        res.m_extents[dim] = (last - first + step - 1) / step;
+        res.m_strides[dim] = m_strides[dim] * step;
+        return res;
+    }
+
+    /**
+     * @brief view with one dimension less, where index of dimension dim is fixed. subView(0, i) of a matrix is row i.
+     * if out of range throws std::out_of_range
+     * 
+     * @param dim
+     * @param index
+     * @return MdView<T, Rank - 1>
+     */
+    MdView<T, Rank - 1> subView(size_t dim, size_t index) const {
+        static_assert(Rank > 1, "subView of a one dimensional view would have no dimensions");
+        if(dim >= Rank || index >= m_extents[dim]) throw std::out_of_range("Index is out of range");
+        MdView<T, Rank - 1> res;
+        res.m_data = m_data + index * m_strides[dim];
+        for (size_t d = 0, r = 0; d < Rank; d++)
+        {
+            if(d == dim) continue;
+            res.m_extents[r] = m_extents[d];
+            res.m_strides[r] = m_strides[d];
+            r++;
+        }
+        return res;
+    }
+
+    /**
+     * @brief the same elements with the dimensions in reverse order, no elements are moved
+     * 
+     * @return MdView
+     */
+    MdView transposed() const {
+        MdView res(*this);
+        for (size_t d = 0; d < Rank; d++)
+        {
+            res.m_extents[d] = m_extents[Rank - 1 - d];
+            res.m_strides[d] = m_strides[Rank - 1 - d];
+        }
+        return res;
+    }
+
+    /**
+     * @brief calls f(tile, firstRow, firstColumn) for tile x tile views covering a matrix, so work on
+     * neighbouring elements of both dimensions stays within a few cache lines
+     * 
+     * @tparam Function callable as void(MdView<T, 2>, size_t, size_t)
+     * @param tile side of a tile, tiles at the edges are smaller
+     * @param f
+     */
+    template<typename Function>
+    MdView const &forEachTile(size_t tile, Function &&f) const {
+        static_assert(Rank == 2, "forEachTile requires a matrix");
+        if(tile == 0) throw std::invalid_argument("Tile is empty");
+        bool rowsOuter = m_strides[0] >= m_strides[1];
+        size_t outerDim = rowsOuter ? 0 : 1;
+        size_t innerDim = 1 - outerDim;
+        for (size_t outer = 0; outer < m_extents[outerDim]; outer += tile)
+        {
+            size_t outerLast = outer + tile < m_extents[outerDim] ? outer + tile : m_extents[outerDim];
+            for (size_t inner = 0; inner < m_extents[innerDim]; inner += tile)
+            {
+                size_t innerLast = inner + tile < m_extents[innerDim] ? inner + tile : m_extents[innerDim];
+                MdView part = slice(outerDim, outer, outerLast).slice(innerDim, inner, innerLast);
+                if(rowsOuter) f(part, outer, inner);
+                else f(part, inner, outer);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the elements, in memory order
+     * 
+     * @tparam Function callable as void(T const &)
+     * @param f
+     */
+    template<typename Function>
+    MdView const &forEach(Function &&f) const {
+        visit([&f](T const &val, Array<size_t, Rank> const &) { f(val); });
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the referce to the element, in memory order
+     * 
+     * @tparam Function callable as void(T &)
+     * @param f
+     */
+    template<typename Function>
+    MdView const &transformReference(Function &&f) const {
+        visit([&f](T &val, Array<size_t, Rank> const &) { f(val); });
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element, in memory order
+     * 
+     * @tparam Function callable as T(T const &)
+     * @param f
+     */
+    template<typename Function>
+    MdView const &transformAndCopy(Function &&f) const {
+        visit([&f](T &val, Array<size_t, Rank> const &) { val = f(val); });
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the elements, in memory order
+     * 
+     * @tparam Function callable as void(T const &, Array<size_t, Rank> const &)
+     * @param f
+     */
+    template<typename Function>
+    MdView const &forEachWithIndex(Function &&f) const {
+        visit([&f](T const &val, Array<size_t, Rank> const &index) { f(val, index); });
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the referce to the element, in memory order
+     * 
+     * @tparam Function callable as void(T &, Array<size_t, Rank> const &)
+     * @param f
+     */
+    template<typename Function>
+    MdView const &transformReferenceWithIndex(Function &&f) const {
+        visit([&f](T &val, Array<size_t, Rank> const &index) { f(val, index); });
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element, in memory order
+     * 
+     * @tparam Function callable as T(T const &, Array<size_t, Rank> const &)
+     * @param f
+     */
+    template<typename Function>
+    MdView const &transformAndCopyWithIndex(Function &&f) const {
+        visit([&f](T &val, Array<size_t, Rank> const &index) { val = f(val, index); });
+        return *this;
+    }
+};
+
+/**
+ * @brief dst(j, i) = src(i, j). Works on square blocks, so both the reads and the writes use whole cache lines
+ * instead of one element of a line per access. src and dst must not overlap,
+ * if dst is not of the transposed shape of src throws std::invalid_argument
+ * 
+ * @tparam T
+ * @tparam U
+ * @param src
+ * @param dst
+ */
+template<typename T, typename U>
+void transpose(MdView<T, 2> const &src, MdView<U, 2> const &dst) {
+    if(dst.extent(0) != src.extent(1) || dst.extent(1) != src.extent(0)) throw std::invalid_argument("Shapes do not match");
+    const size_t block = mdTransposeBlock<U>();
+    size_t rows = src.extent(0);
+    size_t cols = src.extent(1);
+    size_t srcRowStride = src.stride(0);
+    size_t srcColStride = src.stride(1);
+    size_t dstRowStride = dst.stride(0);
+    size_t dstColStride = dst.stride(1);
+    T *from = src.data();
+    U *to = dst.data();
+    for (size_t i0 = 0; i0 < rows; i0 += block)
+    {
+        size_t iLast = i0 + block < rows ? i0 + block : rows;
+        for (size_t j0 = 0; j0 < cols; j0 += block)
+        {
+            size_t jLast = j0 + block < cols ? j0 + block : cols;
+            // the inner loop runs along the side with the smaller stride, usually the rows of dst
+            if(dstColStride <= srcColStride) {
+                for (size_t j = j0; j < jLast; j++)
+                {
+                    for (size_t i = i0; i < iLast; i++)
+                    {
+                        to[j * dstRowStride + i * dstColStride] = from[i * srcRowStride + j * srcColStride];
+                    }
+                }
+            } else {
+                for (size_t i = i0; i < iLast; i++)
+                {
+                    for (size_t j = j0; j < jLast; j++)
+                    {
+                        to[j * dstRowStride + i * dstColStride] = from[i * srcRowStride + j * srcColStride];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief product of all Dims
+ * 
+ */
+template<size_t... Dims>
+constexpr size_t mdSize() {
+    return (Dims * ... * size_t(1));
+}
+
+/**
+ * @brief owning row major grid of T with compile time extents Dims, stored in one Array.
+ * Column major data, slices and transposes are handled through MdView
+ * 
+ * @tparam T type
+ * @tparam Dims extent of every dimension
+ */
+template<typename T, size_t... Dims>
+class MdArray {
+    static_assert(sizeof...(Dims) > 0, "MdArray needs at least one dimension");
+    static_assert(((Dims > 0) && ...), "MdArray extents must not be 0");
+
+    static constexpr size_t Rank = sizeof...(Dims);
+    static constexpr size_t Size = mdSize<Dims...>();
+
+    Array<T, Size> m_data;
+
+    static constexpr size_t offset(Array<size_t, Rank> const &index) {
+        constexpr Array<size_t, Rank> extents{Dims...};
+        size_t res{};
+        for (size_t d = 0; d < Rank; d++)
+        {
+            res = res * extents[d] + index[d];
+        }
+        return res;
+    }
+
+    static constexpr size_t checkedOffset(Array<size_t, Rank> const &index) {
+        for (size_t d = 0; d < Rank; d++)
+        {
+            if(index[d] >= extent(d)) throw std::out_of_range("Index is out of range");
+        }
+        return offset(index);
+    }
+
+public:
+    constexpr MdArray() = default;
+
+    /**
+     * @brief Construct a new Md Array object without initializing the elements
+     * 
+     */
+    explicit MdArray(Uninitialized) : m_data(uninitialized) {}
+
+    /**
+     * @brief Construct a new Md Array object by filling it with val
+     * 
+     * @param val
+     */
+    constexpr MdArray(T const &val) : m_data(val) {}
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index one index per dimension
+     * @return T&
+     */
+    template<typename... Indices>
+    constexpr T &operator()(Indices... index) {
+        static_assert(sizeof...(Indices) == Rank, "one index per dimension");
+        return m_data[offset(Array<size_t, Rank>{static_cast<size_t>(index)...})];
+    }
+
+    template<typename... Indices>
+    constexpr T const &operator()(Indices... index) const {
+        static_assert(sizeof...(Indices) == Rank, "one index per dimension");
+        return m_data[offset(Array<size_t, Rank>{static_cast<size_t>(index)...})];
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index one index per dimension
+     * @return T&
+     */
+    template<typename... Indices>
+    constexpr T &at(Indices... index) {
+        return m_data[checkedOffset(Array<size_t, Rank>{static_cast<size_t>(index)...})];
+    }
+
+    template<typename... Indices>
+    constexpr T const &at(Indices... index) const {
+        return m_data[checkedOffset(Array<size_t, Rank>{static_cast<size_t>(index)...})];
+    }
+
+    static constexpr size_t rank() {
+        return Rank;
+    }
+
+    static constexpr size_t extent(size_t dim) {
+        constexpr Array<size_t, Rank> extents{Dims...};
+        return extents[dim];
+    }
+
+    static constexpr size_t size() {
+        return Size;
+    }
+
+    constexpr T *data() {
+        return m_data.data();
+    }
+
+    constexpr T const *data() const {
+        return m_data.data();
+    }
+
+    /**
+     * @brief elements in row major order as an Array, for the whole Array API
+     * 
+     * @return Array<T, Size>&
+     */
+    constexpr Array<T, Size> &flat() {
+        return m_data;
+    }
+
+    constexpr Array<T, Size> const &flat() const {
+        return m_data;
+    }
+
+    MdView<T, Rank> view() {
+        return MdView<T, Rank>(m_data.data(), Array<size_t, Rank>{Dims...});
+    }
+
+    MdView<T const, Rank> view() const {
+        return MdView<T const, Rank>(m_data.data(), Array<size_t, Rank>{Dims...});
+    }
+
+    /**
+     * @brief copy with the dimensions in reverse order, matrices are transposed block by block
+     * 
+     * @return MdArray with reversed Dims
+     */
+    template<size_t R = Rank, typename = std::enable_if_t<R == 2>>
+    auto transposed() const {
+        constexpr Array<size_t, Rank> extents{Dims...};
+        MdArray<T, extents[1], extents[0]> res;
+        transpose(view(), res.view());
+        return res;
+    }
+
+    /**
+     * @brief calls f(tile, firstRow, firstColumn) for tile x tile views covering the matrix
+     * 
+     * @tparam Function callable as void(MdView<T, 2>, size_t, size_t)
+     * @param tile
+     * @param f
+     */
+    template<typename Function>
+    MdArray &forEachTile(size_t tile, Function &&f) {
+        view().forEachTile(tile, f);
+        return *this;
+    }
+
+    template<typename Function>
+    MdArray const &forEachTile(size_t tile, Function &&f) const {
+        view().forEachTile(tile, f);
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the array
+     * 
+     * @tparam Function callable as void(T const &)
+     * @param f
+     */
+    template<typename Function>
+    constexpr MdArray const &forEach(Function &&f) const {
+        m_data.forEach(f);
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the referce to the array element
+     * 
+     * @tparam Function callable as void(T &)
+     * @param f
+     */
+    template<typename Function>
+    constexpr MdArray &transformReference(Function &&f) {
+        m_data.transformReference(f);
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element
+     * 
+     * @tparam Function callable as T(T const &)
+     * @param f
+     */
+    template<typename Function>
+    constexpr MdArray &transformAndCopy(Function &&f) {
+        m_data.transformAndCopy(f);
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the array
+     * 
+     * @tparam Function callable as void(T const &, Array<size_t, Rank> const &)
+     * @param f
+     */
+    template<typename Function>
+    MdArray const &forEachWithIndex(Function &&f) const {
+        view().forEachWithIndex(f);
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the referce to the array element
+     * 
+     * @tparam Function callable as void(T &, Array<size_t, Rank> const &)
+     * @param f
+     */
+    template<typename Function>
+    MdArray &transformReferenceWithIndex(Function &&f) {
+        view().transformReferenceWithIndex(f);
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element
+     * 
+     * @tparam Function callable as T(T const &, Array<size_t, Rank> const &)
+     * @param f
+     */
+    template<typename Function>
+    MdArray &transformAndCopyWithIndex(Function &&f) {
+        view().transformAndCopyWithIndex(f);
+        return *this;
+    }
+
+    constexpr bool operator==(MdArray const &rhs) const {
+        return m_data == rhs.m_data;
+    }
+
+    constexpr bool operator!=(MdArray const &rhs) const {
+        return m_data != rhs.m_data;
+    }
+};
+
+} // namespace TAS
@@ -0,0 +1,257 @@
+/**
+ * @file MpmcQueue.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the MpmcQueue class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace TAS
+{
+
+/**
+ * @brief bounded lock free queue for any amount of producer and consumer threads.
+ * Every slot carries a sequence number telling whose turn it is: a producer may fill the slot for
+ * position pos when the sequence equals pos, a consumer may empty it when the sequence equals pos + 1.
+ * Threads claim positions with one compare exchange on the enqueue or dequeue counter
+ * and hand slots over with one release store on the sequence, so producers and consumers
+ * only contend with their own side
+ * 
+ * @tparam T type with a noexcept move constructor, it does not have to be copyable or default constructible
+ */
+template<typename T>
+class MpmcQueue {
+    static_assert(std::is_nothrow_move_constructible<T>::value, "T must be nothrow move constructible");
+
+    static const size_t lineSize{64};
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() {
+            return std::launder(reinterpret_cast<T *>(storage));
+        }
+    };
+
+    Slot *m_slots;
+    size_t m_mask;
+
+    alignas(lineSize) std::atomic<size_t> m_enqueuePos{0};
+    alignas(lineSize) std::atomic<size_t> m_dequeuePos{0};
+
+    /**
+     * @brief claims the next free slot, nullptr if the queue is full
+     * 
+     */
+    Slot *claimEnqueue(size_t &pos) {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while(true) {
+            Slot *slot = m_slots + (pos & m_mask);
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            if(sequence == pos) {
+                if(m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return slot;
+            } else if(static_cast<std::ptrdiff_t>(sequence - pos) < 0) {
+                return nullptr;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief claims the oldest filled slot, nullptr if the queue is empty
+     * 
+     */
+    Slot *claimDequeue(size_t &pos) {
+        pos = m_dequeuePos.load(std::memory_order_relaxed);
+        while(true) {
+            Slot *slot = m_slots + (pos & m_mask);
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            if(sequence == pos + 1) {
+                if(m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return slot;
+            } else if(static_cast<std::ptrdiff_t>(sequence - (pos + 1)) < 0) {
+                return nullptr;
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief moves the element out of a claimed slot and hands the slot back to producers
+     * before anything that may throw runs
+     * 
+     */
+    T release(Slot *slot, size_t pos) {
+        T res(std::move(*slot->value()));
+        slot->value()->~T();
+        slot->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return res;
+    }
+
+    /**
+     * @brief spins a few rounds, then gives the core away so a waiting thread does not starve the one it waits for
+     * 
+     */
+    static void backoff(size_t &attempt) {
+        if(++attempt > 16) std::this_thread::yield();
+    }
+
+public:
+    /**
+     * @brief Construct a new Mpmc Queue object holding at most capacity elements,
+     * if capacity is not a power of two (or less than 2) throws std::invalid_argument
+     * 
+     * @param capacity
+     */
+    explicit MpmcQueue(size_t capacity) {
+        if(capacity < 2 || (capacity & (capacity - 1)) != 0) throw std::invalid_argument("Capacity must be a power of two not less than 2");
+        m_slots = new Slot[capacity];
+        m_mask = capacity - 1;
+        for (size_t i = 0; i < capacity; i++)
+        {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(MpmcQueue const &) = delete;
+    MpmcQueue &operator=(MpmcQueue const &) = delete;
+
+    /**
+     * @brief destroys the remaining elements, no thread may use the queue anymore
+     * 
+     */
+    ~MpmcQueue() {
+        size_t pos;
+        while(Slot *slot = claimDequeue(pos)) {
+            slot->value()->~T();
+        }
+        delete[] m_slots;
+    }
+
+    /**
+     * @brief constructs an element from args unless the queue is full.
+     * If constructing T from args may throw the element is constructed before a slot is claimed
+     * 
+     * @return true if the element was pushed
+     */
+    template<typename... Args>
+    bool tryEmplace(Args &&...args) {
+        if constexpr (std::is_nothrow_constructible<T, Args &&...>::value) {
+            size_t pos;
+            Slot *slot = claimEnqueue(pos);
+            if(!slot) return false;
+            new (slot->storage) T(std::forward<Args>(args)...);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        } else {
+            T val(std::forward<Args>(args)...);
+            return tryEmplace(std::move(val));
+        }
+    }
+
+    /**
+     * @brief pushes a copy of val unless the queue is full
+     * 
+     * @param val
+     * @return true if val was pushed, false if the queue is full
+     */
+    bool tryPush(T const &val) {
+        return tryEmplace(val);
+    }
+
+    /**
+     * @brief val is only moved from if it was pushed
+     * 
+     * @param val
+     * @return true if val was pushed, false if the queue is full
+     */
+    bool tryPush(T &&val) {
+        return tryEmplace(std::move(val));
+    }
+
+    /**
+     * @brief pops the oldest element unless the queue is empty
+     * 
+     * @param val receives the oldest element
+     * @return true if an element was popped, false if the queue is empty
+     */
+    bool tryPop(T &val) {
+        size_t pos;
+        Slot *slot = claimDequeue(pos);
+        if(!slot) return false;
+        val = release(slot, pos);
+        return true;
+    }
+
+    /**
+     * @brief constructs an element from args, waits while the queue is full
+     * 
+     */
+    template<typename... Args>
+    MpmcQueue &emplace(Args &&...args) {
+        T val(std::forward<Args>(args)...);
+        for (size_t attempt = 0; !tryEmplace(std::move(val)); backoff(attempt));
+        return *this;
+    }
+
+    /**
+     * @brief pushes val, waits while the queue is full
+     * 
+     * @param val
+     */
+    MpmcQueue &push(T const &val) {
+        return emplace(val);
+    }
+
+    MpmcQueue &push(T &&val) {
+        for (size_t attempt = 0; !tryEmplace(std::move(val)); backoff(attempt));
+        return *this;
+    }
+
+    /**
+     * @brief pops the oldest element, waits while the queue is empty
+     * 
+     * @return T
+     */
+    T pop() {
+        size_t pos;
+        Slot *slot;
+        for (size_t attempt = 0; !(slot = claimDequeue(pos)); backoff(attempt));
+        return release(slot, pos);
+    }
+
+    /**
+     * @brief amount of elements, only exact when no thread is working on the queue
+     * 
+     * @return size_t
+     */
+    size_t size() const {
+        size_t dequeued = m_dequeuePos.load(std::memory_order_acquire);
+        size_t enqueued = m_enqueuePos.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t capacity() const {
+        return m_mask + 1;
+    }
+};
+
+} // namespace TAS
@@ -0,0 +1,271 @@
+/**
+ * @file Pipeline.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the Pipeline class, lazy map / filter / reduce chains over contiguous ranges
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
+
+namespace TAS
+{
+
+/**
+ * @brief first stage of every Pipeline, pushes the elements of a contiguous range
+ * 
+ * @tparam T element type
+ */
+template<typename T>
+class PipelineSource {
+    T const *m_data;
+    size_t m_size;
+
+public:
+    typedef T ValueType;
+
+    constexpr PipelineSource(T const *data, size_t size) : m_data(data), m_size(size) {}
+
+    /**
+     * @brief calls sink with every element until it returns false
+     * 
+     */
+    template<typename Sink>
+    constexpr void operator()(Sink &&sink) const {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            if(!sink(m_data[i])) return;
+        }
+    }
+};
+
+/**
+ * @brief pushes f(x) for every x pushed by Previous
+ * 
+ */
+template<typename Previous, typename Function>
+class PipelineMap {
+    Previous m_previous;
+    Function m_function;
+
+public:
+    typedef std::decay_t<decltype(std::declval<Function const &>()(std::declval<typename Previous::ValueType const &>()))> ValueType;
+
+    constexpr PipelineMap(Previous previous, Function function) : m_previous(std::move(previous)), m_function(std::move(function)) {}
+
+    template<typename Sink>
+    constexpr void operator()(Sink &&sink) const {
+        m_previous([&](auto &&x) {
+            return sink(m_function(x));
+        });
+    }
+};
+
+/**
+ * @brief pushes the x pushed by Previous for which predicate(x) is true
+ * 
+ */
+template<typename Previous, typename Predicate>
+class PipelineFilter {
+    Previous m_previous;
+    Predicate m_predicate;
+
+public:
+    typedef typename Previous::ValueType ValueType;
+
+    constexpr PipelineFilter(Previous previous, Predicate predicate) : m_previous(std::move(previous)), m_predicate(std::move(predicate)) {}
+
+    template<typename Sink>
+    constexpr void operator()(Sink &&sink) const {
+        m_previous([&](auto &&x) {
+            return m_predicate(x) ? sink(std::forward<decltype(x)>(x)) : true;
+        });
+    }
+};
+
+/**
+ * @brief pushes the first count elements pushed by Previous and stops it
+ * 
+ */
+template<typename Previous>
+class PipelineTake {
+    Previous m_previous;
+    size_t m_count;
+
+public:
+    typedef typename Previous::ValueType ValueType;
+
+    constexpr PipelineTake(Previous previous, size_t count) : m_previous(std::move(previous)), m_count(count) {}
+
+    template<typename Sink>
+    constexpr void operator()(Sink &&sink) const {
+        size_t left = m_count;
+        if(!left) return;
+        m_previous([&](auto &&x) {
+            return sink(std::forward<decltype(x)>(x)) && --left != 0;
+        });
+    }
+};
+
+/**
+ * @brief lazy chain of stages over a range, created by view() of Array, BasicString and BasicStringRef.
+ * map, filter and take only wrap the previous stage, nothing runs until a terminal operation
+ * (forEach, reduce, sum, count, any, collect) is called. Then the source pushes every element through
+ * all stages, which are inlined into one loop: no intermediate containers, no calls through pointers.
+ * WARNING: a Pipeline keeps a pointer to the viewed range, which must outlive it
+ * 
+ * @tparam Stage last stage, callable with a sink that returns false to stop the source
+ */
+template<typename Stage>
+class Pipeline {
+    Stage m_stage;
+
+public:
+    /**
+     * @brief type of the elements leaving the last stage
+     * 
+     */
+    typedef typename Stage::ValueType ValueType;
+
+    constexpr explicit Pipeline(Stage stage) : m_stage(std::move(stage)) {}
+
+    /**
+     * @brief lazily replaces every element x with f(x)
+     * 
+     * @tparam Function callable as U(ValueType const &)
+     * @param f
+     */
+    template<typename Function>
+    constexpr auto map(Function f) const {
+        return Pipeline<PipelineMap<Stage, Function>>(PipelineMap<Stage, Function>(m_stage, std::move(f)));
+    }
+
+    /**
+     * @brief lazily drops the elements for which predicate is false
+     * 
+     * @tparam Predicate callable as bool(ValueType const &)
+     * @param predicate
+     */
+    template<typename Predicate>
+    constexpr auto filter(Predicate predicate) const {
+        return Pipeline<PipelineFilter<Stage, Predicate>>(PipelineFilter<Stage, Predicate>(m_stage, std::move(predicate)));
+    }
+
+    /**
+     * @brief lazily keeps only the first count elements, the source stops after them
+     * 
+     * @param count
+     */
+    constexpr auto take(size_t count) const {
+        return Pipeline<PipelineTake<Stage>>(PipelineTake<Stage>(m_stage, count));
+    }
+
+    /**
+     * @brief Applies Lambda to every element leaving the pipeline
+     * 
+     * @tparam Function callable as void(ValueType const &)
+     * @param f
+     */
+    template<typename Function>
+    constexpr Pipeline const &forEach(Function &&f) const {
+        m_stage([&](auto &&x) {
+            f(x);
+            return true;
+        });
+        return *this;
+    }
+
+    /**
+     * @brief folds the elements from left to right: acc = f(acc, x), starting from init
+     * 
+     * @tparam Accumulator
+     * @tparam Function callable as Accumulator(Accumulator, ValueType const &)
+     * @param init
+     * @param f
+     * @return Accumulator
+     */
+    template<typename Accumulator, typename Function>
+    constexpr Accumulator reduce(Accumulator init, Function &&f) const {
+        m_stage([&](auto &&x) {
+            init = f(std::move(init), x);
+            return true;
+        });
+        return init;
+    }
+
+    /**
+     * @brief sum of the elements, ValueType{} if there are none
+     * 
+     * @return ValueType
+     */
+    constexpr ValueType sum() const {
+        ValueType res{};
+        m_stage([&](auto &&x) {
+            res += x;
+            return true;
+        });
+        return res;
+    }
+
+    /**
+     * @brief amount of elements leaving the pipeline
+     * 
+     * @return size_t
+     */
+    constexpr size_t count() const {
+        size_t res{};
+        m_stage([&](auto &&) {
+            res++;
+            return true;
+        });
+        return res;
+    }
+
+    /**
+     * @brief true if any element leaves the pipeline, stops the source at the first one
+     * 
+     * @return bool
+     */
+    constexpr bool any() const {
+        bool res = false;
+        m_stage([&](auto &&) {
+            res = true;
+            return false;
+        });
+        return res;
+    }
+
+    /**
+     * @brief appends the elements to res
+     * 
+     * @tparam Container container with pushBack, like Vector or SmallVector
+     * @param res
+     * @return Container&
+     */
+    template<typename Container>
+    Container &collect(Container &res) const {
+        m_stage([&](auto &&x) {
+            res.pushBack(std::forward<decltype(x)>(x));
+            return true;
+        });
+        return res;
+    }
+};
+
+/**
+ * @brief Pipeline over n elements starting at data
+ * 
+ */
+template<typename T>
+constexpr Pipeline<PipelineSource<T>> pipelineOf(T const *data, size_t n) {
+    return Pipeline<PipelineSource<T>>(PipelineSource<T>(data, n));
+}
+
+} // namespace TAS
@@ -0,0 +1,71 @@
+/**
+ * @file Search.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains branchless binary search over sorted ranges
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+namespace TAS
+{
+
+/**
+ * @brief index of the first element of sorted [data, data + n) that is not less than val, n if there is none.
+ * The loop runs exactly log2(n) times and picks the next half with a conditional move instead of a branch,
+ * both possible next probes are prefetched
+ * 
+ * @tparam T
+ * @tparam Compare strict weak ordering
+ * @param data
+ * @param n
+ * @param val
+ * @param comp
+ * @return size_t
+ */
+template<typename T, typename Compare>
+size_t branchlessLowerBound(T const *data, size_t n, T const &val, Compare comp) {
+    if(n == 0) return 0;
+    T const *base = data;
+    while(n > 1) {
+        size_t half = n / 2;
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+        base = comp(base[half], val) ? base + half : base;
+        n -= half;
+    }
+    return (base - data) + comp(*base, val);
+}
+
+/**
+ * @brief index of the first element of sorted [data, data + n) that is greater than val, n if there is none
+ * 
+ * @tparam T
+ * @tparam Compare strict weak ordering
+ * @param data
+ * @param n
+ * @param val
+ * @param comp
+ * @return size_t
+ */
+template<typename T, typename Compare>
+size_t branchlessUpperBound(T const *data, size_t n, T const &val, Compare comp) {
+    if(n == 0) return 0;
+    T const *base = data;
+    while(n > 1) {
+        size_t half = n / 2;
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+        base = !comp(val, base[half]) ? base + half : base;
+        n -= half;
+    }
+    return (base - data) + !comp(val, *base);
+}
+
+} // namespace TAS
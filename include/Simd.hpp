@@ -0,0 +1,912 @@
+/**
+ * @file Simd.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains SIMD reduction and arithmetic kernels over raw arrays
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace TAS
+{
+
+/**
+ * @brief vector operations of the widest instruction set enabled at compile time (AVX-512, AVX/AVX2 or SSE2).
+ * enabled is false for types without explicit kernels, those use plain loops
+ * 
+ * @tparam T
+ */
+template<typename T>
+struct SimdTraits {
+    static constexpr bool enabled = false;
+    static constexpr size_t width = 1;
+};
+
+#if defined(__AVX512F__)
+
+template<>
+struct SimdTraits<float> {
+    typedef __m512 Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 16;
+
+    static Vector load(float const *p) { return _mm512_loadu_ps(p); }
+    static void store(float *p, Vector v) { _mm512_storeu_ps(p, v); }
+    static Vector set1(float x) { return _mm512_set1_ps(x); }
+    static Vector add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm512_mul_ps(a, b); }
+    static Vector fma(Vector a, Vector b, Vector c) { return _mm512_fmadd_ps(a, b, c); }
+    // masked forms, the plain ones make GCC 12 warn about an uninitialized operand
+    static Vector min(Vector a, Vector b) { return _mm512_mask_min_ps(a, 0xFFFF, a, b); }
+    static Vector max(Vector a, Vector b) { return _mm512_mask_max_ps(a, 0xFFFF, a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ)); }
+    static float reduceAdd(Vector v) {
+        float lanes[width];
+        store(lanes, v);
+        float res = lanes[0];
+        for (size_t i = 1; i < width; i++) res += lanes[i];
+        return res;
+    }
+    static float reduceMin(Vector v) {
+        float lanes[width];
+        store(lanes, v);
+        float res = lanes[0];
+        for (size_t i = 1; i < width; i++) if(lanes[i] < res) res = lanes[i];
+        return res;
+    }
+    static float reduceMax(Vector v) {
+        float lanes[width];
+        store(lanes, v);
+        float res = lanes[0];
+        for (size_t i = 1; i < width; i++) if(lanes[i] > res) res = lanes[i];
+        return res;
+    }
+};
+
+template<>
+struct SimdTraits<double> {
+    typedef __m512d Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 8;
+
+    static Vector load(double const *p) { return _mm512_loadu_pd(p); }
+    static void store(double *p, Vector v) { _mm512_storeu_pd(p, v); }
+    static Vector set1(double x) { return _mm512_set1_pd(x); }
+    static Vector add(Vector a, Vector b) { return _mm512_add_pd(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm512_mul_pd(a, b); }
+    static Vector fma(Vector a, Vector b, Vector c) { return _mm512_fmadd_pd(a, b, c); }
+    static Vector min(Vector a, Vector b) { return _mm512_mask_min_pd(a, 0xFF, a, b); }
+    static Vector max(Vector a, Vector b) { return _mm512_mask_max_pd(a, 0xFF, a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ)); }
+    static double reduceAdd(Vector v) {
+        double lanes[width];
+        store(lanes, v);
+        double res = lanes[0];
+        for (size_t i = 1; i < width; i++) res += lanes[i];
+        return res;
+    }
+    static double reduceMin(Vector v) {
+        double lanes[width];
+        store(lanes, v);
+        double res = lanes[0];
+        for (size_t i = 1; i < width; i++) if(lanes[i] < res) res = lanes[i];
+        return res;
+    }
+    static double reduceMax(Vector v) {
+        double lanes[width];
+        store(lanes, v);
+        double res = lanes[0];
+        for (size_t i = 1; i < width; i++) if(lanes[i] > res) res = lanes[i];
+        return res;
+    }
+};
+
+template<>
+struct SimdTraits<int32_t> {
+    typedef __m512i Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 16;
+
+    static Vector load(int32_t const *p) { return _mm512_loadu_si512(p); }
+    static void store(int32_t *p, Vector v) { _mm512_storeu_si512(p, v); }
+    static Vector set1(int32_t x) { return _mm512_set1_epi32(x); }
+    static Vector add(Vector a, Vector b) { return _mm512_add_epi32(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm512_mullo_epi32(a, b); }
+    static Vector fma(Vector a, Vector b, Vector c) { return add(mul(a, b), c); }
+    static Vector min(Vector a, Vector b) { return _mm512_mask_min_epi32(a, 0xFFFF, a, b); }
+    static Vector max(Vector a, Vector b) { return _mm512_mask_max_epi32(a, 0xFFFF, a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm512_cmpeq_epi32_mask(a, b)); }
+    static int32_t reduceAdd(Vector v) {
+        int32_t lanes[width];
+        store(lanes, v);
+        int32_t res = lanes[0];
+        for (size_t i = 1; i < width; i++) res += lanes[i];
+        return res;
+    }
+    static int32_t reduceMin(Vector v) {
+        int32_t lanes[width];
+        store(lanes, v);
+        int32_t res = lanes[0];
+        for (size_t i = 1; i < width; i++) if(lanes[i] < res) res = lanes[i];
+        return res;
+    }
+    static int32_t reduceMax(Vector v) {
+        int32_t lanes[width];
+        store(lanes, v);
+        int32_t res = lanes[0];
+        for (size_t i = 1; i < width; i++) if(lanes[i] > res) res = lanes[i];
+        return res;
+    }
+};
+
+#elif defined(__AVX__)
+
+template<>
+struct SimdTraits<float> {
+    typedef __m256 Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 8;
+
+    static Vector load(float const *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, Vector v) { _mm256_storeu_ps(p, v); }
+    static Vector set1(float x) { return _mm256_set1_ps(x); }
+    static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+#if defined(__FMA__)
+    static Vector fma(Vector a, Vector b, Vector c) { return _mm256_fmadd_ps(a, b, c); }
+#else
+    static Vector fma(Vector a, Vector b, Vector c) { return add(mul(a, b), c); }
+#endif
+    static Vector min(Vector a, Vector b) { return _mm256_min_ps(a, b); }
+    static Vector max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ))); }
+    static __m128 half(Vector v) { return _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)); }
+    static float reduceAdd(Vector v) {
+        __m128 x = half(v);
+        x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+        x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+    static float reduceMin(Vector v) {
+        __m128 x = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        x = _mm_min_ps(x, _mm_movehl_ps(x, x));
+        x = _mm_min_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+    static float reduceMax(Vector v) {
+        __m128 x = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        x = _mm_max_ps(x, _mm_movehl_ps(x, x));
+        x = _mm_max_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+};
+
+template<>
+struct SimdTraits<double> {
+    typedef __m256d Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 4;
+
+    static Vector load(double const *p) { return _mm256_loadu_pd(p); }
+    static void store(double *p, Vector v) { _mm256_storeu_pd(p, v); }
+    static Vector set1(double x) { return _mm256_set1_pd(x); }
+    static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+#if defined(__FMA__)
+    static Vector fma(Vector a, Vector b, Vector c) { return _mm256_fmadd_pd(a, b, c); }
+#else
+    static Vector fma(Vector a, Vector b, Vector c) { return add(mul(a, b), c); }
+#endif
+    static Vector min(Vector a, Vector b) { return _mm256_min_pd(a, b); }
+    static Vector max(Vector a, Vector b) { return _mm256_max_pd(a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ))); }
+    static double reduceAdd(Vector v) {
+        __m128d x = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+    }
+    static double reduceMin(Vector v) {
+        __m128d x = _mm_min_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        return _mm_cvtsd_f64(_mm_min_sd(x, _mm_unpackhi_pd(x, x)));
+    }
+    static double reduceMax(Vector v) {
+        __m128d x = _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x)));
+    }
+};
+
+#if defined(__AVX2__)
+template<>
+struct SimdTraits<int32_t> {
+    typedef __m256i Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 8;
+
+    static Vector load(int32_t const *p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p)); }
+    static void store(int32_t *p, Vector v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    static Vector set1(int32_t x) { return _mm256_set1_epi32(x); }
+    static Vector add(Vector a, Vector b) { return _mm256_add_epi32(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm256_mullo_epi32(a, b); }
+    static Vector fma(Vector a, Vector b, Vector c) { return add(mul(a, b), c); }
+    static Vector min(Vector a, Vector b) { return _mm256_min_epi32(a, b); }
+    static Vector max(Vector a, Vector b) { return _mm256_max_epi32(a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)))); }
+    static int32_t reduceAdd(Vector v) {
+        __m128i x = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, 0x4E));
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, 0xB1));
+        return _mm_cvtsi128_si32(x);
+    }
+    static int32_t reduceMin(Vector v) {
+        __m128i x = _mm_min_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        x = _mm_min_epi32(x, _mm_shuffle_epi32(x, 0x4E));
+        x = _mm_min_epi32(x, _mm_shuffle_epi32(x, 0xB1));
+        return _mm_cvtsi128_si32(x);
+    }
+    static int32_t reduceMax(Vector v) {
+        __m128i x = _mm_max_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        x = _mm_max_epi32(x, _mm_shuffle_epi32(x, 0x4E));
+        x = _mm_max_epi32(x, _mm_shuffle_epi32(x, 0xB1));
+        return _mm_cvtsi128_si32(x);
+    }
+};
+#endif
+
+#elif defined(__SSE2__)
+
+template<>
+struct SimdTraits<float> {
+    typedef __m128 Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 4;
+
+    static Vector load(float const *p) { return _mm_loadu_ps(p); }
+    static void store(float *p, Vector v) { _mm_storeu_ps(p, v); }
+    static Vector set1(float x) { return _mm_set1_ps(x); }
+    static Vector add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+    static Vector fma(Vector a, Vector b, Vector c) { return add(mul(a, b), c); }
+    static Vector min(Vector a, Vector b) { return _mm_min_ps(a, b); }
+    static Vector max(Vector a, Vector b) { return _mm_max_ps(a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm_movemask_ps(_mm_cmpeq_ps(a, b))); }
+    static float reduceAdd(Vector x) {
+        x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+        x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+    static float reduceMin(Vector x) {
+        x = _mm_min_ps(x, _mm_movehl_ps(x, x));
+        x = _mm_min_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+    static float reduceMax(Vector x) {
+        x = _mm_max_ps(x, _mm_movehl_ps(x, x));
+        x = _mm_max_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+};
+
+template<>
+struct SimdTraits<double> {
+    typedef __m128d Vector;
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 2;
+
+    static Vector load(double const *p) { return _mm_loadu_pd(p); }
+    static void store(double *p, Vector v) { _mm_storeu_pd(p, v); }
+    static Vector set1(double x) { return _mm_set1_pd(x); }
+    static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+    static Vector fma(Vector a, Vector b, Vector c) { return add(mul(a, b), c); }
+    static Vector min(Vector a, Vector b) { return _mm_min_pd(a, b); }
+    static Vector max(Vector a, Vector b) { return _mm_max_pd(a, b); }
+    static size_t countEqual(Vector a, Vector b) { return __builtin_popcount(_mm_movemask_pd(_mm_cmpeq_pd(a, b))); }
+    static double reduceAdd(Vector x) { return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x))); }
+    static double reduceMin(Vector x) { return _mm_cvtsd_f64(_mm_min_sd(x, _mm_unpackhi_pd(x, x))); }
+    static double reduceMax(Vector x) { return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x))); }
+};
+
+#endif
+
+/**
+ * @brief elements summed straight (in 4 vector accumulators) before pairwise summation takes over
+ * 
+ */
+static const size_t simdPairwiseBlock{1024};
+
+/**
+ * @brief sum of n elements. Floating point types use pairwise summation,
+ * so the rounding error grows with O(log n) instead of O(n)
+ * 
+ * @tparam T arithmetic type
+ * @param data
+ * @param n
+ * @return T
+ */
+template<typename T>
+T simdSum(T const *data, size_t n) {
+    typedef SimdTraits<T> Simd;
+    if(std::is_floating_point<T>::value && n > simdPairwiseBlock) {
+        size_t half = n / 2 / (4 * Simd::width) * (4 * Simd::width);
+        return simdSum(data, half) + simdSum(data + half, n - half);
+    }
+
+    T res{};
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        typename Simd::Vector acc0 = Simd::set1(0), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        for (; i + 4 * Simd::width <= n; i += 4 * Simd::width)
+        {
+            acc0 = Simd::add(acc0, Simd::load(data + i));
+            acc1 = Simd::add(acc1, Simd::load(data + i + Simd::width));
+            acc2 = Simd::add(acc2, Simd::load(data + i + 2 * Simd::width));
+            acc3 = Simd::add(acc3, Simd::load(data + i + 3 * Simd::width));
+        }
+        res = Simd::reduceAdd(Simd::add(Simd::add(acc0, acc1), Simd::add(acc2, acc3)));
+    }
+    for (; i < n; i++)
+    {
+        res += data[i];
+    }
+    return res;
+}
+
+/**
+ * @brief sum of data[i] * other[i]. Floating point types use pairwise summation
+ * 
+ * @tparam T arithmetic type
+ * @param data
+ * @param other
+ * @param n
+ * @return T
+ */
+template<typename T>
+T simdDot(T const *data, T const *other, size_t n) {
+    typedef SimdTraits<T> Simd;
+    if(std::is_floating_point<T>::value && n > simdPairwiseBlock) {
+        size_t half = n / 2 / (4 * Simd::width) * (4 * Simd::width);
+        return simdDot(data, other, half) + simdDot(data + half, other + half, n - half);
+    }
+
+    T res{};
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        typename Simd::Vector acc0 = Simd::set1(0), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        for (; i + 4 * Simd::width <= n; i += 4 * Simd::width)
+        {
+            acc0 = Simd::fma(Simd::load(data + i), Simd::load(other + i), acc0);
+            acc1 = Simd::fma(Simd::load(data + i + Simd::width), Simd::load(other + i + Simd::width), acc1);
+            acc2 = Simd::fma(Simd::load(data + i + 2 * Simd::width), Simd::load(other + i + 2 * Simd::width), acc2);
+            acc3 = Simd::fma(Simd::load(data + i + 3 * Simd::width), Simd::load(other + i + 3 * Simd::width), acc3);
+        }
+        res = Simd::reduceAdd(Simd::add(Simd::add(acc0, acc1), Simd::add(acc2, acc3)));
+    }
+    for (; i < n; i++)
+    {
+        res += data[i] * other[i];
+    }
+    return res;
+}
+
+/**
+ * @brief smallest of n > 0 elements. Result is unspecified if data contains NaN
+ * 
+ * @tparam T arithmetic type
+ * @param data
+ * @param n
+ * @return T
+ */
+template<typename T>
+T simdMin(T const *data, size_t n) {
+    typedef SimdTraits<T> Simd;
+    T res = data[0];
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        if(n >= Simd::width) {
+            typename Simd::Vector acc = Simd::load(data);
+            for (i = Simd::width; i < n - n % Simd::width; i += Simd::width)
+            {
+                acc = Simd::min(acc, Simd::load(data + i));
+            }
+            res = Simd::reduceMin(acc);
+        }
+    }
+    for (; i < n; i++)
+    {
+        if(data[i] < res) res = data[i];
+    }
+    return res;
+}
+
+/**
+ * @brief largest of n > 0 elements. Result is unspecified if data contains NaN
+ * 
+ * @tparam T arithmetic type
+ * @param data
+ * @param n
+ * @return T
+ */
+template<typename T>
+T simdMax(T const *data, size_t n) {
+    typedef SimdTraits<T> Simd;
+    T res = data[0];
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        if(n >= Simd::width) {
+            typename Simd::Vector acc = Simd::load(data);
+            for (i = Simd::width; i < n - n % Simd::width; i += Simd::width)
+            {
+                acc = Simd::max(acc, Simd::load(data + i));
+            }
+            res = Simd::reduceMax(acc);
+        }
+    }
+    for (; i < n; i++)
+    {
+        if(data[i] > res) res = data[i];
+    }
+    return res;
+}
+
+/**
+ * @brief amount of elements equal to val
+ * 
+ * @tparam T arithmetic type
+ * @param data
+ * @param n
+ * @param val
+ * @return size_t
+ */
+template<typename T>
+size_t simdCount(T const *data, size_t n, T val) {
+    typedef SimdTraits<T> Simd;
+    size_t res{};
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        typename Simd::Vector needle = Simd::set1(val);
+        for (size_t vectorEnd = n - n % Simd::width; i < vectorEnd; i += Simd::width)
+        {
+            res += Simd::countEqual(Simd::load(data + i), needle);
+        }
+    }
+    for (; i < n; i++)
+    {
+        res += data[i] == val;
+    }
+    return res;
+}
+
+/**
+ * @brief true for types whose equality is equality of their object representations, so equal elements can
+ * be found by comparing bytes: integers, enums, pointers and other scalars without padding bits.
+ * Floating point types are excluded (-0.0 == 0.0, NaN != NaN). Structs without padding whose operator==
+ * compares all members can opt in by specializing this as std::true_type
+ * 
+ * @tparam T
+ */
+template<typename T>
+struct BytewiseEquality : std::integral_constant<bool,
+    std::is_scalar<T>::value && !std::is_floating_point<T>::value && std::has_unique_object_representations<T>::value> {};
+
+/**
+ * @brief true if elements of T can be compared a vector at a time by BytewiseMatch
+ * 
+ */
+template<typename T>
+constexpr bool bytewiseMatchable() {
+    return BytewiseEquality<T>::value && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+}
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+/**
+ * @brief compares the bytes at p with pattern as elements of Bytes bytes. Returns a byte mask
+ * (one bit per byte) in which all Bytes bits of an element are set when the element is equal
+ * 
+ */
+template<size_t Bytes>
+struct BytewiseMatch {
+#if defined(__AVX2__)
+    typedef __m256i Vector;
+    static constexpr size_t width = 32;
+    typedef uint32_t Mask;
+
+    static Vector load(void const *p) { return _mm256_loadu_si256(static_cast<__m256i const *>(p)); }
+
+    static Mask match(void const *p, Vector pattern) {
+        Vector v = load(p);
+        Vector eq;
+        if constexpr (Bytes == 1) eq = _mm256_cmpeq_epi8(v, pattern);
+        else if constexpr (Bytes == 2) eq = _mm256_cmpeq_epi16(v, pattern);
+        else if constexpr (Bytes == 4) eq = _mm256_cmpeq_epi32(v, pattern);
+        else eq = _mm256_cmpeq_epi64(v, pattern);
+        return static_cast<Mask>(_mm256_movemask_epi8(eq));
+    }
+#else
+    typedef __m128i Vector;
+    static constexpr size_t width = 16;
+    typedef uint32_t Mask;
+
+    static Vector load(void const *p) { return _mm_loadu_si128(static_cast<__m128i const *>(p)); }
+
+    static Mask match(void const *p, Vector pattern) {
+        Vector v = load(p);
+        if constexpr (Bytes == 1) return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, pattern)));
+        else if constexpr (Bytes == 2) return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi16(v, pattern)));
+        else if constexpr (Bytes == 4) return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi32(v, pattern)));
+        else {
+            // SSE2 has no 64 bit compare, an element is equal when both of its halves are
+            Mask halves = static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi32(v, pattern)));
+            Mask both = halves & (halves >> 4) & 0x0F0Fu;
+            return both | (both << 4);
+        }
+    }
+#endif
+
+    /**
+     * @brief val repeated over a whole vector
+     * 
+     */
+    template<typename T>
+    static Vector broadcast(T const &val) {
+        alignas(64) unsigned char pattern[width];
+        for (size_t offset = 0; offset < width; offset += Bytes)
+        {
+            memcpy(pattern + offset, &val, Bytes);
+        }
+        return load(pattern);
+    }
+};
+
+#endif
+
+/**
+ * @brief index of the first element equal to val, n if there is none.
+ * Elements of 1, 2, 4 or 8 bytes with BytewiseEquality are compared a vector at a time
+ * 
+ * @tparam T
+ * @param data
+ * @param n
+ * @param val
+ * @return size_t
+ */
+template<typename T>
+size_t simdIndexOf(T const *data, size_t n, T const &val) {
+    size_t i{};
+#if defined(__AVX2__) || defined(__SSE2__)
+    if constexpr (bytewiseMatchable<T>()) {
+        typedef BytewiseMatch<sizeof(T)> Match;
+        const size_t elements = Match::width / sizeof(T);
+        typename Match::Vector pattern = Match::broadcast(val);
+        for (size_t vectorEnd = n - n % elements; i < vectorEnd; i += elements)
+        {
+            typename Match::Mask mask = Match::match(data + i, pattern);
+            if(mask) return i + __builtin_ctz(mask) / sizeof(T);
+        }
+    }
+#endif
+    for (; i < n; i++)
+    {
+        if(data[i] == val) return i;
+    }
+    return n;
+}
+
+/**
+ * @brief amount of elements equal to val. Elements of 1, 2, 4 or 8 bytes with BytewiseEquality
+ * are compared a vector at a time, arithmetic types with SimdTraits use simdCount
+ * 
+ * @tparam T
+ * @param data
+ * @param n
+ * @param val
+ * @return size_t
+ */
+template<typename T>
+size_t simdCountEqual(T const *data, size_t n, T const &val) {
+    if constexpr (!bytewiseMatchable<T>() && SimdTraits<T>::enabled) {
+        return simdCount(data, n, val);
+    } else {
+        size_t res{};
+        size_t i{};
+#if defined(__AVX2__) || defined(__SSE2__)
+        if constexpr (bytewiseMatchable<T>()) {
+            typedef BytewiseMatch<sizeof(T)> Match;
+            const size_t elements = Match::width / sizeof(T);
+            typename Match::Vector pattern = Match::broadcast(val);
+            size_t matchingBytes{};
+            for (size_t vectorEnd = n - n % elements; i < vectorEnd; i += elements)
+            {
+                matchingBytes += __builtin_popcount(Match::match(data + i, pattern));
+            }
+            res = matchingBytes / sizeof(T);
+        }
+#endif
+        for (; i < n; i++)
+        {
+            res += data[i] == val;
+        }
+        return res;
+    }
+}
+
+/**
+ * @brief true if the n elements of a and b are equal, elements with BytewiseEquality are compared with memcmp
+ * 
+ * @tparam T
+ * @param a
+ * @param b
+ * @param n
+ * @return bool
+ */
+template<typename T>
+bool simdEqual(T const *a, T const *b, size_t n) {
+    if constexpr (BytewiseEquality<T>::value) {
+        return n == 0 || memcmp(a, b, n * sizeof(T)) == 0;
+    } else {
+        for (size_t i = 0; i < n; i++)
+        {
+            if(a[i] != b[i]) return false;
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief data[i] += other[i]
+ * 
+ */
+template<typename T>
+void simdAdd(T *data, T const *other, size_t n) {
+    typedef SimdTraits<T> Simd;
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        for (size_t vectorEnd = n - n % Simd::width; i < vectorEnd; i += Simd::width)
+        {
+            Simd::store(data + i, Simd::add(Simd::load(data + i), Simd::load(other + i)));
+        }
+    }
+    for (; i < n; i++)
+    {
+        data[i] += other[i];
+    }
+}
+
+/**
+ * @brief data[i] *= other[i]
+ * 
+ */
+template<typename T>
+void simdMul(T *data, T const *other, size_t n) {
+    typedef SimdTraits<T> Simd;
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        for (size_t vectorEnd = n - n % Simd::width; i < vectorEnd; i += Simd::width)
+        {
+            Simd::store(data + i, Simd::mul(Simd::load(data + i), Simd::load(other + i)));
+        }
+    }
+    for (; i < n; i++)
+    {
+        data[i] *= other[i];
+    }
+}
+
+/**
+ * @brief data[i] = data[i] * b[i] + c[i], fused where the instruction set allows
+ * 
+ */
+template<typename T>
+void simdFma(T *data, T const *b, T const *c, size_t n) {
+    typedef SimdTraits<T> Simd;
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        for (size_t vectorEnd = n - n % Simd::width; i < vectorEnd; i += Simd::width)
+        {
+            Simd::store(data + i, Simd::fma(Simd::load(data + i), Simd::load(b + i), Simd::load(c + i)));
+        }
+    }
+    for (; i < n; i++)
+    {
+        data[i] = data[i] * b[i] + c[i];
+    }
+}
+
+/**
+ * @brief data[i] *= factor
+ * 
+ */
+template<typename T>
+void simdScale(T *data, T factor, size_t n) {
+    typedef SimdTraits<T> Simd;
+    size_t i{};
+    if constexpr (Simd::enabled) {
+        typename Simd::Vector f = Simd::set1(factor);
+        for (size_t vectorEnd = n - n % Simd::width; i < vectorEnd; i += Simd::width)
+        {
+            Simd::store(data + i, Simd::mul(Simd::load(data + i), f));
+        }
+    }
+    for (; i < n; i++)
+    {
+        data[i] *= factor;
+    }
+}
+
+/**
+ * @brief amount of set bits in n words. Uses VPOPCNTQ with AVX-512 VPOPCNTDQ, with AVX2 it looks up the
+ * count of every nibble with a byte shuffle and sums bytes with a sum of absolute differences
+ * 
+ * @param data
+ * @param n
+ * @return size_t
+ */
+inline size_t simdPopcount(uint64_t const *data, size_t n) {
+    size_t res{};
+    size_t i{};
+#if defined(__AVX512VPOPCNTDQ__)
+    __m512i counts = _mm512_setzero_si512();
+    for (size_t vectorEnd = n - n % 8; i < vectorEnd; i += 8)
+    {
+        counts = _mm512_add_epi64(counts, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i)));
+    }
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, counts);
+    for (uint64_t lane : lanes) res += static_cast<size_t>(lane);
+#elif defined(__AVX2__)
+    const __m256i nibbleCounts = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+    __m256i counts = _mm256_setzero_si256();
+    for (size_t vectorEnd = n - n % 4; i < vectorEnd; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i));
+        __m256i low = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(v, lowNibbles));
+        __m256i high = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibbles));
+        counts = _mm256_add_epi64(counts, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), counts);
+    res = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#endif
+    for (; i < n; i++)
+    {
+        res += __builtin_popcountll(data[i]);
+    }
+    return res;
+}
+
+/**
+ * @brief bitwise operation of simdBitwise
+ * 
+ */
+enum class BitOp {And, Or, Xor, AndNot};
+
+/**
+ * @brief data[i] = data[i] Op other[i] for n words, AndNot is data[i] & ~other[i]
+ * 
+ */
+template<BitOp Op>
+void simdBitwise(uint64_t *data, uint64_t const *other, size_t n) {
+    size_t i{};
+#if defined(__AVX512F__)
+    for (size_t vectorEnd = n - n % 8; i < vectorEnd; i += 8)
+    {
+        __m512i a = _mm512_loadu_si512(data + i);
+        __m512i b = _mm512_loadu_si512(other + i);
+        if constexpr (Op == BitOp::And) a = _mm512_and_si512(a, b);
+        else if constexpr (Op == BitOp::Or) a = _mm512_or_si512(a, b);
+        else if constexpr (Op == BitOp::Xor) a = _mm512_xor_si512(a, b);
+        // masked form, the plain one makes GCC 12 warn about an uninitialized operand
+        else a = _mm512_mask_andnot_epi64(a, 0xFF, b, a);
+        _mm512_storeu_si512(data + i, a);
+    }
+#elif defined(__AVX2__)
+    for (size_t vectorEnd = n - n % 4; i < vectorEnd; i += 4)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(other + i));
+        if constexpr (Op == BitOp::And) a = _mm256_and_si256(a, b);
+        else if constexpr (Op == BitOp::Or) a = _mm256_or_si256(a, b);
+        else if constexpr (Op == BitOp::Xor) a = _mm256_xor_si256(a, b);
+        else a = _mm256_andnot_si256(b, a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + i), a);
+    }
+#elif defined(__SSE2__)
+    for (size_t vectorEnd = n - n % 2; i < vectorEnd; i += 2)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(other + i));
+        if constexpr (Op == BitOp::And) a = _mm_and_si128(a, b);
+        else if constexpr (Op == BitOp::Or) a = _mm_or_si128(a, b);
+        else if constexpr (Op == BitOp::Xor) a = _mm_xor_si128(a, b);
+        else a = _mm_andnot_si128(b, a);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), a);
+    }
+#endif
+    for (; i < n; i++)
+    {
+        if constexpr (Op == BitOp::And) data[i] &= other[i];
+        else if constexpr (Op == BitOp::Or) data[i] |= other[i];
+        else if constexpr (Op == BitOp::Xor) data[i] ^= other[i];
+        else data[i] &= ~other[i];
+    }
+}
+
+/**
+ * @brief sets n elements to val with non-temporal stores, which write whole cache lines to memory without
+ * reading them first and without evicting the cache. Only pays off for buffers much larger than the last level cache.
+ * Types that do not tile a 64 byte pattern and misaligned data use a plain loop
+ * 
+ * @tparam T trivially copyable type
+ */
+template<typename T>
+void simdStreamFill(T *data, size_t n, T const &val) {
+    size_t i{};
+#if defined(__SSE2__)
+    if constexpr (std::is_trivially_copyable<T>::value && 64 % sizeof(T) == 0) {
+        if(reinterpret_cast<uintptr_t>(data) % sizeof(T) == 0) {
+            alignas(64) unsigned char pattern[64];
+            for (size_t offset = 0; offset < 64; offset += sizeof(T))
+            {
+                memcpy(pattern + offset, &val, sizeof(T));
+            }
+#if defined(__AVX512F__)
+            const size_t width = 64;
+            __m512i vec[64 / width];
+            for (size_t v = 0; v < 64 / width; v++) vec[v] = _mm512_load_si512(pattern + v * width);
+#elif defined(__AVX__)
+            const size_t width = 32;
+            __m256i vec[64 / width];
+            for (size_t v = 0; v < 64 / width; v++) vec[v] = _mm256_load_si256(reinterpret_cast<__m256i const *>(pattern + v * width));
+#else
+            const size_t width = 16;
+            __m128i vec[64 / width];
+            for (size_t v = 0; v < 64 / width; v++) vec[v] = _mm_load_si128(reinterpret_cast<__m128i const *>(pattern + v * width));
+#endif
+            // stream stores need aligned addresses
+            for (; i < n && reinterpret_cast<uintptr_t>(data + i) % width != 0; i++)
+            {
+                data[i] = val;
+            }
+            // whole pattern lines keep every element intact even if sizeof(T) is larger than the vector width
+            unsigned char *bytes = reinterpret_cast<unsigned char *>(data + i);
+            size_t lines = (n - i) * sizeof(T) / 64;
+            for (size_t line = 0; line < lines; line++)
+            {
+                for (size_t v = 0; v < 64 / width; v++)
+                {
+#if defined(__AVX512F__)
+                    _mm512_stream_si512(reinterpret_cast<__m512i *>(bytes + line * 64 + v * width), vec[v]);
+#elif defined(__AVX__)
+                    _mm256_stream_si256(reinterpret_cast<__m256i *>(bytes + line * 64 + v * width), vec[v]);
+#else
+                    _mm_stream_si128(reinterpret_cast<__m128i *>(bytes + line * 64 + v * width), vec[v]);
+#endif
+                }
+            }
+            // stream stores are weakly ordered, later stores must not overtake them
+            _mm_sfence();
+            i += lines * 64 / sizeof(T);
+        }
+    }
+#endif
+    for (; i < n; i++)
+    {
+        data[i] = val;
+    }
+}
+
+} // namespace TAS
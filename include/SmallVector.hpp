@@ -0,0 +1,183 @@
+/**
+ * @file SmallVector.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the SmallVector class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <Print.hpp>
+#include <Vector.hpp>
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace TAS
+{
+
+/**
+ * @brief Vector that keeps up to N elements inside the object and allocates only when it grows past N.
+ * The inline storage is raw memory like the heap storage, so no element is constructed before it is pushed
+ * 
+ * @tparam T type
+ * @tparam N inline capacity
+ */
+template<typename T, size_t N>
+class SmallVector : public BasicVector<SmallVector<T, N>, T> {
+    static_assert(N > 0, "SmallVector needs inline capacity, use Vector otherwise");
+
+    friend class BasicVector<SmallVector<T, N>, T>;
+    using BasicVector<SmallVector<T, N>, T>::m_data;
+    using BasicVector<SmallVector<T, N>, T>::m_size;
+    using BasicVector<SmallVector<T, N>, T>::m_capacity;
+
+    alignas(T) unsigned char m_inline[N * sizeof(T)];
+
+    T *inlineData() {
+        return reinterpret_cast<T *>(m_inline);
+    }
+
+    bool isInline() const {
+        return m_data == reinterpret_cast<T const *>(m_inline);
+    }
+
+    bool ownsStorage() const {
+        return !isInline();
+    }
+
+    void resetToInline() {
+        m_data = inlineData();
+        m_capacity = N;
+    }
+
+    /**
+     * @brief takes the elements of vec, which is left empty. Heap storage is taken over,
+     * inline elements are relocated one by one
+     * 
+     */
+    void steal(SmallVector &vec) {
+        if(vec.isInline()) {
+            vectorRelocate(vec.m_data, vec.m_size, m_data);
+            m_size = vec.m_size;
+        } else {
+            m_data = vec.m_data;
+            m_size = vec.m_size;
+            m_capacity = vec.m_capacity;
+            vec.resetToInline();
+        }
+        vec.m_size = 0;
+    }
+
+public:
+    using BasicVector<SmallVector<T, N>, T>::emplaceBack;
+    using BasicVector<SmallVector<T, N>, T>::reserve;
+    using BasicVector<SmallVector<T, N>, T>::clear;
+
+    SmallVector() {
+        resetToInline();
+    }
+
+    /**
+     * @brief Construct a new Small Vector object with size elements equal to val
+     * 
+     * @param size
+     * @param val
+     */
+    explicit SmallVector(size_t size, T const &val = T()) {
+        resetToInline();
+        reserve(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            emplaceBack(val);
+        }
+    }
+
+    /**
+     * @brief Construct a new Small Vector object from std::initalizer_list
+     * 
+     * @param val
+     */
+    SmallVector(std::initializer_list<T> const &val) {
+        resetToInline();
+        reserve(val.size());
+        for (T const &element : val) {
+            emplaceBack(element);
+        }
+    }
+
+    SmallVector(SmallVector const &vec) : BasicVector<SmallVector<T, N>, T>() {
+        resetToInline();
+        reserve(vec.m_size);
+        for (size_t i = 0; i < vec.m_size; i++)
+        {
+            emplaceBack(vec.m_data[i]);
+        }
+    }
+
+    SmallVector(SmallVector &&vec) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        resetToInline();
+        steal(vec);
+    }
+
+    ~SmallVector() {
+        clear();
+        this->releaseStorage();
+    }
+
+    SmallVector &operator=(SmallVector const &vec) {
+        if(this != &vec) {
+            SmallVector copy(vec);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&vec) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if(this != &vec) {
+            clear();
+            this->releaseStorage();
+            resetToInline();
+            steal(vec);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief true while the elements are stored inside the object, data() points into the object then
+     * 
+     */
+    bool inlined() const {
+        return isInline();
+    }
+
+    /**
+     * @brief releases the heap capacity that is not used by elements, elements move back inline if they fit
+     * 
+     */
+    SmallVector &shrinkToFit() {
+        if(isInline() || m_size == m_capacity) return *this;
+        if(m_size > N) {
+            this->reallocate(m_size);
+            return *this;
+        }
+        T *data = m_data;
+        vectorRelocate(data, m_size, inlineData());
+        vectorDeallocate(data);
+        resetToInline();
+        return *this;
+    }
+};
+
+template<typename T, size_t N>
+void print(SmallVector<T, N> const &vec) {
+    printVector(vec);
+}
+
+} // namespace TAS
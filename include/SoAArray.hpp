@@ -0,0 +1,402 @@
+/**
+ * @file SoAArray.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the SoAArray class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace TAS
+{
+
+/**
+ * @brief type of the member Field points to
+ * 
+ */
+template<typename Field>
+struct SoAFieldTraits;
+
+template<typename Record, typename T>
+struct SoAFieldTraits<T Record::*> {
+    typedef Record record;
+    typedef T type;
+};
+
+/**
+ * @brief one column of SoAArray, every column starts on its own cache line
+ * 
+ */
+template<typename T, size_t Size>
+struct alignas(64) SoAColumn {
+    Array<T, Size> values;
+};
+
+template<auto A, auto B>
+constexpr bool soaSameField() {
+    if constexpr (std::is_same<decltype(A), decltype(B)>::value) {
+        return A == B;
+    } else {
+        return false;
+    }
+}
+
+/**
+ * @brief Array of Size Records stored as structure of arrays: each listed member of Record
+ * is kept in its own contiguous Array, so a pass over one member only loads that member.
+ * Columns are Arrays, so all Array methods (sum, scale, fma, sort...) work on a single member
+ * 
+ * Elements are accessed through proxies that gather and scatter the listed members,
+ * members of Record that are not listed are not stored
+ * 
+ * @tparam Record default constructible struct
+ * @tparam Size size
+ * @tparam Fields pointers to the stored members of Record, like &Record::x
+ */
+template<typename Record, size_t Size, auto... Fields>
+class SoAArray {
+    static_assert(sizeof...(Fields) > 0, "SoAArray needs at least one field");
+    static_assert((std::is_same<typename SoAFieldTraits<decltype(Fields)>::record, Record>::value && ...),
+        "Fields must be members of Record");
+
+    typedef std::index_sequence_for<decltype(Fields)...> FieldIndices;
+
+    std::tuple<SoAColumn<typename SoAFieldTraits<decltype(Fields)>::type, Size>...> m_columns;
+
+    template<size_t... Is>
+    void gather(size_t index, Record &record, std::index_sequence<Is...>) const {
+        ((record.*Fields = std::get<Is>(m_columns).values[index]), ...);
+    }
+
+    template<size_t... Is>
+    void scatter(size_t index, Record const &val, std::index_sequence<Is...>) {
+        ((std::get<Is>(m_columns).values[index] = val.*Fields), ...);
+    }
+
+public:
+    /**
+     * @brief amount of stored members
+     * 
+     */
+    static constexpr size_t fieldCount = sizeof...(Fields);
+
+    /**
+     * @brief column index of Field, fieldCount if Field is not stored
+     * 
+     */
+    template<auto Field>
+    static constexpr size_t fieldIndex() {
+        constexpr bool matches[] = {soaSameField<Field, Fields>()...};
+        size_t res = 0;
+        while(res < fieldCount && !matches[res]) res++;
+        return res;
+    }
+
+    /**
+     * @brief proxy for element index, reads and writes go straight to the columns
+     * 
+     */
+    class Reference {
+        SoAArray *m_array;
+        size_t m_index;
+
+    public:
+        Reference(SoAArray *array, size_t index) : m_array(array), m_index(index) {}
+
+        template<size_t I>
+        auto &get() const {
+            return m_array->template column<I>()[m_index];
+        }
+
+        template<auto Field>
+        auto &field() const {
+            return m_array->template field<Field>()[m_index];
+        }
+
+        size_t index() const {
+            return m_index;
+        }
+
+        operator Record() const {
+            return m_array->get(m_index);
+        }
+
+        Reference const &operator=(Record const &val) const {
+            m_array->set(m_index, val);
+            return *this;
+        }
+    };
+
+    /**
+     * @brief read only proxy for element index
+     * 
+     */
+    class ConstReference {
+        SoAArray const *m_array;
+        size_t m_index;
+
+    public:
+        ConstReference(SoAArray const *array, size_t index) : m_array(array), m_index(index) {}
+
+        template<size_t I>
+        auto const &get() const {
+            return m_array->template column<I>()[m_index];
+        }
+
+        template<auto Field>
+        auto const &field() const {
+            return m_array->template field<Field>()[m_index];
+        }
+
+        size_t index() const {
+            return m_index;
+        }
+
+        operator Record() const {
+            return m_array->get(m_index);
+        }
+    };
+
+    SoAArray() = default;
+
+    /**
+     * @brief Construct a new SoAArray object from the listed members of records
+     * 
+     * @param records
+     */
+    explicit SoAArray(Array<Record, Size> const &records) {
+        load(records);
+    }
+
+    /**
+     * @brief copies the listed members of records into the columns
+     * 
+     * @param records
+     */
+    SoAArray &load(Array<Record, Size> const &records) {
+        for (size_t i = 0; i < Size; i++)
+        {
+            scatter(i, records[i], FieldIndices{});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief copies the columns into the listed members of records, other members are left untouched
+     * 
+     * @param records
+     */
+    SoAArray const &store(Array<Record, Size> &records) const {
+        for (size_t i = 0; i < Size; i++)
+        {
+            gather(i, records[i], FieldIndices{});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief column I as an Array
+     * 
+     */
+    template<size_t I>
+    auto &column() {
+        return std::get<I>(m_columns).values;
+    }
+
+    template<size_t I>
+    auto const &column() const {
+        return std::get<I>(m_columns).values;
+    }
+
+    /**
+     * @brief column of Field as an Array
+     * 
+     */
+    template<auto Field>
+    auto &field() {
+        static_assert(fieldIndex<Field>() < fieldCount, "Field is not stored in this SoAArray");
+        return column<fieldIndex<Field>()>();
+    }
+
+    template<auto Field>
+    auto const &field() const {
+        static_assert(fieldIndex<Field>() < fieldCount, "Field is not stored in this SoAArray");
+        return column<fieldIndex<Field>()>();
+    }
+
+    /**
+     * @brief element index gathered into a Record
+     * 
+     * @param index
+     * @return Record
+     */
+    Record get(size_t index) const {
+        Record res{};
+        gather(index, res, FieldIndices{});
+        return res;
+    }
+
+    /**
+     * @brief scatters the listed members of val into element index
+     * 
+     * @param index
+     * @param val
+     */
+    SoAArray &set(size_t index, Record const &val) {
+        scatter(index, val, FieldIndices{});
+        return *this;
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return Reference
+     */
+    Reference at(size_t index) {
+        if(index >= Size) throw std::out_of_range("Index is out of range");
+        return Reference(this, index);
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return ConstReference
+     */
+    ConstReference at(size_t index) const {
+        if(index >= Size) throw std::out_of_range("Index is out of range");
+        return ConstReference(this, index);
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return Reference
+     */
+    Reference operator[](size_t index) {
+        return Reference(this, index);
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return ConstReference
+     */
+    ConstReference operator[](size_t index) const {
+        return ConstReference(this, index);
+    }
+
+    constexpr bool empty() const {
+        return !Size;
+    }
+
+    constexpr size_t size() const {
+        return Size;
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the array
+     * 
+     * @tparam Function callable as void(ConstReference)
+     * @param f
+     */
+    template<typename Function>
+    SoAArray const &forEach(Function &&f) const {
+        for (size_t i = 0; i < Size; i++)
+        {
+            f(ConstReference(this, i));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the elements through the proxy
+     * 
+     * @tparam Function callable as void(Reference)
+     * @param f
+     */
+    template<typename Function>
+    SoAArray &transformReference(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
+        {
+            f(Reference(this, i));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element, every element is gathered and scattered
+     * 
+     * @tparam Function callable as Record(Record const &)
+     * @param f
+     */
+    template<typename Function>
+    SoAArray &transformAndCopy(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
+        {
+            set(i, f(get(i)));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the array
+     * 
+     * @tparam Function callable as void(ConstReference, size_t)
+     * @param f
+     */
+    template<typename Function>
+    SoAArray const &forEachWithIndex(Function &&f) const {
+        for (size_t i = 0; i < Size; i++)
+        {
+            f(ConstReference(this, i), i);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the elements through the proxy
+     * 
+     * @tparam Function callable as void(Reference, size_t)
+     * @param f
+     */
+    template<typename Function>
+    SoAArray &transformReferenceWithIndex(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
+        {
+            f(Reference(this, i), i);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element, every element is gathered and scattered
+     * 
+     * @tparam Function callable as Record(Record const &, size_t)
+     * @param f
+     */
+    template<typename Function>
+    SoAArray &transformAndCopyWithIndex(Function &&f) {
+        for (size_t i = 0; i < Size; i++)
+        {
+            set(i, f(get(i), i));
+        }
+        return *this;
+    }
+};
+
+} // namespace TAS
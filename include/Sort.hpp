@@ -0,0 +1,636 @@
+/**
+ * @file Sort.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains sorting algorithms: sorting networks, pattern-defeating quicksort and AVX2 quicksort
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace TAS
+{
+
+/**
+ * @brief ranges smaller than this are sorted by insertion sort
+ * 
+ */
+static const size_t sortInsertionThreshold{24};
+
+/**
+ * @brief ranges larger than this take the pivot as median of 3 medians of 3
+ * 
+ */
+static const size_t sortNintherThreshold{128};
+
+/**
+ * @brief Arrays of arithmetic type up to this Size are sorted by a sorting network
+ * 
+ */
+static const size_t sortNetworkMaxSize{32};
+
+/**
+ * @brief calls visitor(lo, hi) for every comparator of Batcher's odd-even merge sort of N elements
+ * 
+ */
+template<size_t N, typename Visitor>
+constexpr void sortNetworkVisit(Visitor &&visitor) {
+    for (size_t p = 1; p < N; p <<= 1)
+    {
+        for (size_t k = p; k >= 1; k >>= 1)
+        {
+            for (size_t j = k % p; j + k < N; j += 2 * k)
+            {
+                for (size_t i = 0; i < k && i + j + k < N; i++)
+                {
+                    if((i + j) / (2 * p) == (i + j + k) / (2 * p)) visitor(i + j, i + j + k);
+                }
+            }
+        }
+    }
+}
+
+template<size_t N>
+constexpr size_t sortNetworkSize() {
+    size_t res{};
+    sortNetworkVisit<N>([&res](size_t, size_t) { res++; });
+    return res;
+}
+
+template<size_t Count>
+struct SortNetworkComparators {
+    size_t lo[Count ? Count : 1]{};
+    size_t hi[Count ? Count : 1]{};
+};
+
+/**
+ * @brief comparators of the sorting network for N elements, generated at compile time
+ * 
+ * @tparam N
+ */
+template<size_t N>
+struct SortNetwork {
+    static constexpr size_t size = sortNetworkSize<N>();
+
+    static constexpr SortNetworkComparators<size> make() {
+        SortNetworkComparators<size> res{};
+        size_t c{};
+        sortNetworkVisit<N>([&res, &c](size_t lo, size_t hi) {
+            res.lo[c] = lo;
+            res.hi[c] = hi;
+            c++;
+        });
+        return res;
+    }
+
+    static constexpr SortNetworkComparators<size> comparators = make();
+};
+
+/**
+ * @brief orders a and b, compiles to min/max or conditional moves for arithmetic types
+ * 
+ */
+template<typename T>
+inline void sortNetworkExchange(T &a, T &b) {
+    T x = a, y = b;
+    bool swapped = y < x;
+    a = swapped ? y : x;
+    b = swapped ? x : y;
+}
+
+template<typename T, size_t N, size_t... I>
+void sortNetworkApply(T *data, std::index_sequence<I...>) {
+    (sortNetworkExchange(data[SortNetwork<N>::comparators.lo[I]], data[SortNetwork<N>::comparators.hi[I]]), ...);
+}
+
+/**
+ * @brief sorts N elements ascending with a fully unrolled branchless sorting network.
+ * NaN elements leave the order of the whole range unspecified, see sortNanLast
+ * 
+ * @tparam N
+ * @tparam T arithmetic type
+ * @param data
+ */
+template<size_t N, typename T>
+void sortNetwork(T *data) {
+    if constexpr (N > 1) sortNetworkApply<T, N>(data, std::make_index_sequence<SortNetwork<N>::size>());
+}
+
+template<typename T, typename Compare>
+void sortInsertion(T *first, T *last, Compare &comp) {
+    if(first == last) return;
+    for (T *cur = first + 1; cur != last; cur++)
+    {
+        if(!comp(*cur, *(cur - 1))) continue;
+        T tmp = std::move(*cur);
+        T *sift = cur;
+        do {
+            *sift = std::move(*(sift - 1));
+            sift--;
+        } while(sift != first && comp(tmp, *(sift - 1)));
+        *sift = std::move(tmp);
+    }
+}
+
+/**
+ * @brief insertion sort that relies on *(first - 1) not being greater than any element
+ * 
+ */
+template<typename T, typename Compare>
+void sortUnguardedInsertion(T *first, T *last, Compare &comp) {
+    if(first == last) return;
+    for (T *cur = first + 1; cur != last; cur++)
+    {
+        if(!comp(*cur, *(cur - 1))) continue;
+        T tmp = std::move(*cur);
+        T *sift = cur;
+        do {
+            *sift = std::move(*(sift - 1));
+            sift--;
+        } while(comp(tmp, *(sift - 1)));
+        *sift = std::move(tmp);
+    }
+}
+
+/**
+ * @brief insertion sort that gives up after moving 8 elements
+ * 
+ * @return true if the range got sorted
+ */
+template<typename T, typename Compare>
+bool sortPartialInsertion(T *first, T *last, Compare &comp) {
+    if(first == last) return true;
+    size_t moved{};
+    for (T *cur = first + 1; cur != last; cur++)
+    {
+        if(!comp(*cur, *(cur - 1))) continue;
+        T tmp = std::move(*cur);
+        T *sift = cur;
+        do {
+            *sift = std::move(*(sift - 1));
+            sift--;
+        } while(sift != first && comp(tmp, *(sift - 1)));
+        *sift = std::move(tmp);
+        moved += cur - sift;
+        if(moved > 8) return false;
+    }
+    return true;
+}
+
+template<typename T, typename Compare>
+void sortThree(T *a, T *b, T *c, Compare &comp) {
+    if(comp(*b, *a)) std::swap(*a, *b);
+    if(comp(*c, *b)) std::swap(*b, *c);
+    if(comp(*b, *a)) std::swap(*a, *b);
+}
+
+/**
+ * @brief moves the median of 3 (or of 3 medians of 3 for large ranges) to *first
+ * 
+ */
+template<typename T, typename Compare>
+void sortChoosePivot(T *first, T *last, Compare &comp) {
+    size_t n = last - first;
+    size_t half = n / 2;
+    if(n > sortNintherThreshold) {
+        sortThree(first, first + half, last - 1, comp);
+        sortThree(first + 1, first + half - 1, last - 2, comp);
+        sortThree(first + 2, first + half + 1, last - 3, comp);
+        sortThree(first + half - 1, first + half, first + half + 1, comp);
+        std::swap(*first, *(first + half));
+    } else {
+        sortThree(first + half, first, last - 1, comp);
+    }
+}
+
+/**
+ * @brief partitions around pivot *first, elements equal to the pivot go right
+ * 
+ * @return std::pair<T*, bool> final position of the pivot and whether the range was already partitioned
+ */
+template<typename T, typename Compare>
+std::pair<T *, bool> sortPartitionRight(T *first, T *last, Compare &comp) {
+    T pivot = std::move(*first);
+    T *l = first, *r = last;
+    while(comp(*++l, pivot));
+    if(l - 1 == first) {
+        while(l < r && !comp(*--r, pivot));
+    } else {
+        while(!comp(*--r, pivot));
+    }
+    bool alreadyPartitioned = l >= r;
+    while(l < r) {
+        std::swap(*l, *r);
+        while(comp(*++l, pivot));
+        while(!comp(*--r, pivot));
+    }
+    T *pivotPos = l - 1;
+    *first = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+    return {pivotPos, alreadyPartitioned};
+}
+
+/**
+ * @brief partitions around pivot *first, elements equal to the pivot go left.
+ * Used when the pivot equals the element before the range, then the left part needs no more sorting
+ * 
+ * @return T* final position of the pivot
+ */
+template<typename T, typename Compare>
+T *sortPartitionLeft(T *first, T *last, Compare &comp) {
+    T pivot = std::move(*first);
+    T *l = first, *r = last;
+    while(comp(pivot, *--r));
+    if(r + 1 == last) {
+        while(l < r && !comp(pivot, *++l));
+    } else {
+        while(!comp(pivot, *++l));
+    }
+    while(l < r) {
+        std::swap(*l, *r);
+        while(comp(pivot, *--r));
+        while(!comp(pivot, *++l));
+    }
+    *first = std::move(*r);
+    *r = std::move(pivot);
+    return r;
+}
+
+template<typename T, typename Compare>
+void sortHeap(T *first, T *last, Compare &comp) {
+    std::make_heap(first, last, comp);
+    std::sort_heap(first, last, comp);
+}
+
+/**
+ * @brief floor(log2(n)), the amount of unbalanced partitions allowed before falling back to heapsort
+ * 
+ */
+inline size_t sortBadPartitionLimit(size_t n) {
+    size_t res{};
+    for (; n > 1; n >>= 1) res++;
+    return res;
+}
+
+template<typename T, typename Compare>
+void pdqSortLoop(T *first, T *last, Compare &comp, size_t badAllowed, bool leftmost) {
+    while(true) {
+        size_t n = last - first;
+        if(n < sortInsertionThreshold) {
+            if(leftmost) sortInsertion(first, last, comp);
+            else sortUnguardedInsertion(first, last, comp);
+            return;
+        }
+
+        sortChoosePivot(first, last, comp);
+        if(!leftmost && !comp(*(first - 1), *first)) {
+            first = sortPartitionLeft(first, last, comp) + 1;
+            continue;
+        }
+
+        std::pair<T *, bool> partition = sortPartitionRight(first, last, comp);
+        T *pivotPos = partition.first;
+        size_t leftSize = pivotPos - first;
+        size_t rightSize = last - (pivotPos + 1);
+
+        if(leftSize < n / 8 || rightSize < n / 8) {
+            if(--badAllowed == 0) {
+                sortHeap(first, last, comp);
+                return;
+            }
+            // breaks patterns that made the pivot bad
+            if(leftSize >= sortInsertionThreshold) {
+                std::swap(*first, *(first + leftSize / 4));
+                std::swap(*(pivotPos - 1), *(pivotPos - leftSize / 4));
+            }
+            if(rightSize >= sortInsertionThreshold) {
+                std::swap(*(pivotPos + 1), *(pivotPos + 1 + rightSize / 4));
+                std::swap(*(last - 1), *(last - rightSize / 4));
+            }
+        } else if(partition.second && sortPartialInsertion(first, pivotPos, comp) && sortPartialInsertion(pivotPos + 1, last, comp)) {
+            return;
+        }
+
+        pdqSortLoop(first, pivotPos, comp, badAllowed, leftmost);
+        first = pivotPos + 1;
+        leftmost = false;
+    }
+}
+
+/**
+ * @brief sorts [first, last) with pattern-defeating quicksort: O(n log n) worst case,
+ * O(n) on sorted, reversed and equal ranges. Not stable.
+ * std::less is no strict weak ordering for floating point ranges with NaN, see sortNanLast
+ * 
+ * @tparam T
+ * @tparam Compare strict weak ordering
+ * @param first
+ * @param last
+ * @param comp
+ */
+template<typename T, typename Compare>
+void pdqSort(T *first, T *last, Compare comp) {
+    if(last - first < 2) return;
+    pdqSortLoop(first, last, comp, sortBadPartitionLimit(last - first), true);
+}
+
+/**
+ * @brief AVX2 operations used by vectorQuicksort, enabled for 32 and 64 bit signed integers and floating point
+ * 
+ * @tparam T
+ */
+template<typename T>
+struct VectorSortTraits {
+    static constexpr bool enabled = false;
+};
+
+#if defined(__AVX2__)
+
+/**
+ * @brief lane permutations of 8 x 32 bit vectors, moving lanes with set mask bits
+ * to the front and the rest to the back, both in original order
+ * 
+ */
+struct SortPermutations {
+    int32_t lanes[256][8]{};
+
+    constexpr SortPermutations() {
+        for (int32_t mask = 0; mask < 256; mask++)
+        {
+            int32_t n{};
+            for (int32_t i = 0; i < 8; i++) if(mask & (1 << i)) lanes[mask][n++] = i;
+            for (int32_t i = 0; i < 8; i++) if(!(mask & (1 << i))) lanes[mask][n++] = i;
+        }
+    }
+};
+
+/**
+ * @brief same as SortPermutations for 4 x 64 bit lanes, as pairs of 32 bit lanes
+ * 
+ */
+struct SortPermutations64 {
+    int32_t lanes[16][8]{};
+
+    constexpr SortPermutations64() {
+        for (int32_t mask = 0; mask < 16; mask++)
+        {
+            int32_t n{};
+            for (int32_t i = 0; i < 4; i++) if(mask & (1 << i)) { lanes[mask][n++] = 2 * i; lanes[mask][n++] = 2 * i + 1; }
+            for (int32_t i = 0; i < 4; i++) if(!(mask & (1 << i))) { lanes[mask][n++] = 2 * i; lanes[mask][n++] = 2 * i + 1; }
+        }
+    }
+};
+
+static constexpr SortPermutations sortPermutations{};
+static constexpr SortPermutations64 sortPermutations64{};
+
+template<>
+struct VectorSortTraits<int32_t> {
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 8;
+    static __m256i load(int32_t const *p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p)); }
+    static void store(int32_t *p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    static unsigned lessMask(__m256i v, int32_t pivot) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(pivot), v)));
+    }
+    static unsigned lessEqualMask(__m256i v, int32_t pivot) {
+        return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, _mm256_set1_epi32(pivot)))) & 0xFF;
+    }
+    static __m256i compress(__m256i v, unsigned mask) {
+        return _mm256_permutevar8x32_epi32(v, load(sortPermutations.lanes[mask]));
+    }
+};
+
+template<>
+struct VectorSortTraits<float> {
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 8;
+    static __m256 load(float const *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, __m256 v) { _mm256_storeu_ps(p, v); }
+    static unsigned lessMask(__m256 v, float pivot) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(v, _mm256_set1_ps(pivot), _CMP_LT_OQ));
+    }
+    static unsigned lessEqualMask(__m256 v, float pivot) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(v, _mm256_set1_ps(pivot), _CMP_LE_OQ));
+    }
+    static __m256 compress(__m256 v, unsigned mask) {
+        return _mm256_permutevar8x32_ps(v, VectorSortTraits<int32_t>::load(sortPermutations.lanes[mask]));
+    }
+};
+
+template<>
+struct VectorSortTraits<int64_t> {
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 4;
+    static __m256i load(int64_t const *p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p)); }
+    static void store(int64_t *p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    static unsigned lessMask(__m256i v, int64_t pivot) {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_set1_epi64x(pivot), v)));
+    }
+    static unsigned lessEqualMask(__m256i v, int64_t pivot) {
+        return ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, _mm256_set1_epi64x(pivot)))) & 0x0F;
+    }
+    static __m256i compress(__m256i v, unsigned mask) {
+        return _mm256_permutevar8x32_epi32(v, VectorSortTraits<int32_t>::load(sortPermutations64.lanes[mask]));
+    }
+};
+
+template<>
+struct VectorSortTraits<double> {
+    static constexpr bool enabled = true;
+    static constexpr size_t width = 4;
+    static __m256d load(double const *p) { return _mm256_loadu_pd(p); }
+    static void store(double *p, __m256d v) { _mm256_storeu_pd(p, v); }
+    static unsigned lessMask(__m256d v, double pivot) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(v, _mm256_set1_pd(pivot), _CMP_LT_OQ));
+    }
+    static unsigned lessEqualMask(__m256d v, double pivot) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(v, _mm256_set1_pd(pivot), _CMP_LE_OQ));
+    }
+    static __m256d compress(__m256d v, unsigned mask) {
+        return _mm256_castsi256_pd(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(v), VectorSortTraits<int32_t>::load(sortPermutations64.lanes[mask])));
+    }
+};
+
+/**
+ * @brief writes the lanes of v that belong left at left and the others right before right
+ * 
+ */
+template<bool OrEqual, typename T, typename Vector>
+void vectorPartitionStore(Vector v, T pivot, T *&left, T *&right) {
+    typedef VectorSortTraits<T> Traits;
+    unsigned mask = OrEqual ? Traits::lessEqualMask(v, pivot) : Traits::lessMask(v, pivot);
+    size_t leftCount = __builtin_popcount(mask);
+    Vector compressed = Traits::compress(v, mask);
+    Traits::store(left, compressed);
+    Traits::store(right - Traits::width, compressed);
+    left += leftCount;
+    right -= Traits::width - leftCount;
+}
+
+/**
+ * @brief partitions n >= 2 * width elements in place into elements less (or equal if OrEqual) than pivot
+ * and the rest. Whole vectors are stored at both write ends, so the first and the last vector are
+ * kept in registers to make room and every next vector is read from the end with less room
+ * 
+ * @return size_t amount of elements in the left part
+ */
+template<bool OrEqual, typename T>
+size_t vectorPartition(T *data, size_t n, T pivot) {
+    typedef VectorSortTraits<T> Traits;
+    constexpr size_t width = Traits::width;
+
+    auto first = Traits::load(data);
+    auto last = Traits::load(data + n - width);
+    T *readLeft = data + width, *readRight = data + n - width;
+    T *left = data, *right = data + n;
+
+    while(static_cast<size_t>(readRight - readLeft) >= width) {
+        if(readLeft - left <= right - readRight) {
+            auto v = Traits::load(readLeft);
+            readLeft += width;
+            vectorPartitionStore<OrEqual>(v, pivot, left, right);
+        } else {
+            readRight -= width;
+            auto v = Traits::load(readRight);
+            vectorPartitionStore<OrEqual>(v, pivot, left, right);
+        }
+    }
+
+    T rest[width];
+    size_t restSize = readRight - readLeft;
+    std::copy(readLeft, readRight, rest);
+    for (size_t i = 0; i < restSize; i++)
+    {
+        if(OrEqual ? !(pivot < rest[i]) : rest[i] < pivot) *left++ = rest[i];
+        else *--right = rest[i];
+    }
+    vectorPartitionStore<OrEqual>(first, pivot, left, right);
+    vectorPartitionStore<OrEqual>(last, pivot, left, right);
+    return left - data;
+}
+
+template<typename T>
+void vectorQuicksortLoop(T *data, size_t n, size_t badAllowed) {
+    std::less<T> less;
+    while(n >= sortInsertionThreshold) {
+        sortChoosePivot(data, data + n, less);
+        T pivot = data[0];
+
+        size_t mid = vectorPartition<false>(data, n, pivot);
+        if(mid == 0) {
+            // nothing is less than the pivot, so the elements equal to it are in their final place
+            mid = vectorPartition<true>(data, n, pivot);
+            if(mid == 0) {
+                // only possible with NaN pivot
+                pdqSort(data, data + n, less);
+                return;
+            }
+            data += mid;
+            n -= mid;
+            continue;
+        }
+
+        if((mid < n / 8 || n - mid < n / 8) && --badAllowed == 0) {
+            sortHeap(data, data + n, less);
+            return;
+        }
+        if(mid < n - mid) {
+            vectorQuicksortLoop(data, mid, badAllowed);
+            data += mid;
+            n -= mid;
+        } else {
+            vectorQuicksortLoop(data + mid, n - mid, badAllowed);
+            n = mid;
+        }
+    }
+    sortInsertion(data, data + n, less);
+}
+
+#endif
+
+/**
+ * @brief moves NaN elements behind all the others, the order of the others is not kept.
+ * Does nothing for types other than floating point
+ * 
+ * @tparam T arithmetic type
+ * @param data
+ * @param n
+ * @return size_t count of elements that are not NaN, they are at the beginning
+ */
+template<typename T>
+size_t sortNanLast(T *data, size_t n) {
+    if constexpr (std::is_floating_point<T>::value) {
+        size_t numbers = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if(data[i] == data[i]) std::swap(data[numbers++], data[i]);
+        }
+        return numbers;
+    }
+    return n;
+}
+
+/**
+ * @brief sorts n elements ascending with AVX2 partitioning for int32_t, int64_t, float and double,
+ * other types (and builds without AVX2) use pdqSort. NaN elements are moved to the end in unspecified order
+ * 
+ * @tparam T arithmetic type
+ * @param data
+ * @param n
+ */
+template<typename T>
+void vectorQuicksort(T *data, size_t n) {
+    n = sortNanLast(data, n);
+#if defined(__AVX2__)
+    if constexpr (VectorSortTraits<T>::enabled) {
+        vectorQuicksortLoop(data, n, sortBadPartitionLimit(n) + 1);
+        return;
+    }
+#endif
+    pdqSort(data, data + n, std::less<T>());
+}
+
+/**
+ * @brief reorders [first, last) so that the k smallest elements come first, in unspecified order
+ * 
+ */
+template<typename T, typename Compare>
+void selectSmallest(T *first, T *last, size_t k, Compare comp) {
+    size_t badAllowed = sortBadPartitionLimit(last - first);
+    while(static_cast<size_t>(last - first) >= sortInsertionThreshold) {
+        size_t n = last - first;
+        sortChoosePivot(first, last, comp);
+        T *pivotPos = sortPartitionRight(first, last, comp).first;
+        size_t leftSize = pivotPos - first;
+
+        if((leftSize < n / 8 || n - leftSize - 1 < n / 8) && --badAllowed == 0) {
+            sortHeap(first, last, comp);
+            return;
+        }
+        if(leftSize == k || leftSize + 1 == k) return;
+        if(leftSize > k) {
+            last = pivotPos;
+        } else {
+            k -= leftSize + 1;
+            first = pivotPos + 1;
+        }
+    }
+    sortInsertion(first, last, comp);
+}
+
+} // namespace TAS
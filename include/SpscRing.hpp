@@ -0,0 +1,187 @@
+/**
+ * @file SpscRing.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the SpscRing class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+
+#include <atomic>
+#include <utility>
+
+namespace TAS
+{
+
+/**
+ * @brief lock free queue of at most Capacity elements between exactly one producer thread and one consumer thread.
+ * Head and tail grow forever and are masked into the Array, each lives on its own cache line next to the
+ * producer's or consumer's cached copy of the other one, so the other thread's line is only read when
+ * the cached copy says the ring is full or empty
+ * 
+ * @tparam T default constructible type
+ * @tparam Capacity power of two
+ */
+template<typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    static const size_t lineSize{64};
+    static const size_t mask{Capacity - 1};
+
+    // consumer side: next index to pop and the last tail the consumer has seen
+    alignas(lineSize) std::atomic<size_t> m_head{0};
+    size_t m_cachedTail{0};
+
+    // producer side: next index to push and the last head the producer has seen
+    alignas(lineSize) std::atomic<size_t> m_tail{0};
+    size_t m_cachedHead{0};
+
+    alignas(lineSize) Array<T, Capacity> m_data;
+
+    /**
+     * @brief free slots for the producer, rereads head only if the cached one leaves less than needed
+     * 
+     */
+    size_t freeSlots(size_t tail, size_t needed) {
+        size_t free = Capacity - (tail - m_cachedHead);
+        if(free < needed) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            free = Capacity - (tail - m_cachedHead);
+        }
+        return free;
+    }
+
+    /**
+     * @brief filled slots for the consumer, rereads tail only if the cached one has less than needed
+     * 
+     */
+    size_t filledSlots(size_t head, size_t needed) {
+        size_t filled = m_cachedTail - head;
+        if(filled < needed) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            filled = m_cachedTail - head;
+        }
+        return filled;
+    }
+
+public:
+    SpscRing() = default;
+    SpscRing(SpscRing const &) = delete;
+    SpscRing &operator=(SpscRing const &) = delete;
+
+    /**
+     * @brief producer only, constructs an element from args unless the ring is full
+     * 
+     * @return true if the element was pushed
+     */
+    template<typename... Args>
+    bool tryEmplace(Args &&...args) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if(freeSlots(tail, 1) == 0) return false;
+        m_data[tail & mask] = T(std::forward<Args>(args)...);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief producer only
+     * 
+     * @param val
+     * @return true if val was pushed, false if the ring is full
+     */
+    bool tryPush(T const &val) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if(freeSlots(tail, 1) == 0) return false;
+        m_data[tail & mask] = val;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(T &&val) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if(freeSlots(tail, 1) == 0) return false;
+        m_data[tail & mask] = std::move(val);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief consumer only
+     * 
+     * @param val receives the oldest element
+     * @return true if an element was popped, false if the ring is empty
+     */
+    bool tryPop(T &val) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if(filledSlots(head, 1) == 0) return false;
+        val = std::move(m_data[head & mask]);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief producer only, copies as many of the n items as fit and publishes them at once
+     * 
+     * @param items
+     * @param n
+     * @return size_t amount of pushed items
+     */
+    size_t pushN(T const *items, size_t n) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t free = freeSlots(tail, n);
+        if(n > free) n = free;
+        for (size_t i = 0; i < n; i++)
+        {
+            m_data[(tail + i) & mask] = items[i];
+        }
+        if(n) m_tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief consumer only, moves up to n oldest elements to items and releases their slots at once
+     * 
+     * @param items
+     * @param n
+     * @return size_t amount of popped elements
+     */
+    size_t popN(T *items, size_t n) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        size_t filled = filledSlots(head, n);
+        if(n > filled) n = filled;
+        for (size_t i = 0; i < n; i++)
+        {
+            items[i] = std::move(m_data[(head + i) & mask]);
+        }
+        if(n) m_head.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief amount of elements, only exact when neither thread is working on the ring
+     * 
+     * @return size_t
+     */
+    size_t size() const {
+        size_t head = m_head.load(std::memory_order_acquire);
+        size_t tail = m_tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+};
+
+} // namespace TAS
@@ -16,10 +16,19 @@
 #ifdef DEBUG
 #endif
 
+#include <Pipeline.hpp>
 #include <Print.hpp>
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 #include <iostream>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace TAS {
 
@@ -30,6 +39,21 @@ size_t cStringLength(CharType const *);
 template<typename PointerContainerType>
 void memoryCopy(PointerContainerType *, PointerContainerType const *, size_t);
 
+template<typename CharType>
+void findAllInRange(CharType const *, size_t, CharType const *, size_t, std::vector<size_t> &, size_t = 0);
+
+template<typename CharType>
+std::vector<size_t> parallelFindAll(CharType const *, size_t, CharType const *, size_t, size_t = 0);
+
+template<typename CharType>
+size_t levenshteinDistance(CharType const *, size_t, CharType const *, size_t);
+
+template<typename CharType>
+size_t boundedLevenshteinDistance(CharType const *, size_t, CharType const *, size_t, size_t);
+
+template<typename CharType>
+size_t fuzzyFindFirst(CharType const *, size_t, CharType const *, size_t, size_t);
+
 template<typename CharType>
 class StringIterator;
 
@@ -41,6 +65,9 @@ class ReverseStringIterator;
 
 template<typename CharType>
 class ConstReverseStringIterator;
+
+template<typename CharType>
+class BasicStringRef;
 //FORWARDS
 
 /**
@@ -302,7 +329,7 @@ public:
      * @return StringIterator<CharType> 
      */
     ReverseStringIterator<CharType> rbegin() {
-        return m_data + m_size - 1;
+        return m_data + m_size;
     }
 
     /**
@@ -311,7 +338,7 @@ public:
      * @return StringIterator<CharType> 
      */
     ConstReverseStringIterator<CharType> crbegin() const {
-        return m_data + m_size - 1;
+        return m_data + m_size;
     }
 
     /**
@@ -338,7 +365,7 @@ public:
      * @return StringIterator<CharType> 
      */
     ReverseStringIterator<CharType> rend() {
-        return m_data - 1;
+        return m_data;
     }
 
     /**
@@ -347,7 +374,16 @@ public:
      * @return StringIterator<CharType> 
      */
     ConstReverseStringIterator<CharType> crend() const {
-        return m_data - 1;
+        return m_data;
+    }
+
+    /**
+     * @brief lazy Pipeline over the characters, e.g. str.view().filter(isDigit).count()
+     * 
+     * @return Pipeline 
+     */
+    auto view() const {
+        return pipelineOf(m_data, m_size);
     }
 
     bool empty() const {
@@ -376,6 +412,16 @@ public:
         return m_capacity;
     }
 
+    /**
+     * @brief true if ptr points into the allocated characters, which growing the string may free
+     * 
+     * @param ptr 
+     * @return bool 
+     */
+    bool isInside(CharType const *ptr) const {
+        return std::less_equal<CharType const *>()(m_data, ptr) && std::less<CharType const *>()(ptr, m_data + m_capacity);
+    }
+
     /**
      * @brief allocates new characters if needed
      * 
@@ -507,15 +553,32 @@ public:
      * @return BasicString& 
      */
     BasicString &append(BasicString const &str) {
-        if(m_size + str.size() > m_capacity) {
-            reserve(str.size() + (BlockSize - str.size() % BlockSize));
-        }
+        return append(str.m_data, str.m_size);
+    }
 
-        for (size_t i = 0; i < str.size(); i++) {
-            m_data[i + m_size] = str[i];
+    /**
+     * @brief appends n characters from str to the end of the string
+     * capacity grows geometrically, so repeated appends are amortized O(n)
+     * 
+     * @param str 
+     * @param n 
+     * @return BasicString& 
+     */
+    BasicString &append(CharType const *str, size_t n) {
+        if(m_size + n >= m_capacity) {
+            size_t capacity = m_size + n > 2 * m_capacity ? m_size + n : 2 * m_capacity;
+            capacity += BlockSize - capacity % BlockSize;
+            // str may point into this string, so the old buffer is released last
+            CharType *tmp = new CharType[capacity]{};
+            memoryCopy(tmp, m_data, m_size);
+            memoryCopy(tmp + m_size, str, n);
+            delete[] m_data;
+            m_data = tmp;
+            m_capacity = capacity;
+        } else {
+            memoryCopy(m_data + m_size, str, n);
         }
-
-        m_size += str.size();
+        m_size += n;
         return *this;
     }
 
@@ -786,16 +849,86 @@ public:
         }
         return BasicString::nPos;
     }
+
+    /**
+     * @brief returns indices of all occurences of substr in ascending order
+     * occurences may overlap, empty substr is never found
+     * 
+     * @param str 
+     * @return std::vector<size_t> 
+     */
+    std::vector<size_t> findAll(BasicString const &str) const {
+        std::vector<size_t> res;
+        findAllInRange(m_data, m_size, str.m_data, str.m_size, res, 0);
+        return res;
+    }
+
+    /**
+     * @brief same as findAll, but the string is split into chunks that are searched concurrently
+     * if threads is 0 std::thread::hardware_concurrency() is used
+     * 
+     * @param str 
+     * @param threads 
+     * @return std::vector<size_t> 
+     */
+    std::vector<size_t> parallelFindAll(BasicString const &str, size_t threads = 0) const {
+        return TAS::parallelFindAll(m_data, m_size, str.m_data, str.m_size, threads);
+    }
+
+    /**
+     * @brief Levenshtein distance between this string and str
+     * 
+     * @param str 
+     * @return size_t 
+     */
+    size_t levenshteinDistance(BasicString const &str) const {
+        return TAS::levenshteinDistance(m_data, m_size, str.m_data, str.m_size);
+    }
+
+    /**
+     * @brief Levenshtein distance between this string and str if it is <= k, otherwise k + 1
+     * stops as soon as the distance is known to exceed k
+     * 
+     * @param str 
+     * @param k 
+     * @return size_t 
+     */
+    size_t boundedLevenshteinDistance(BasicString const &str, size_t k) const {
+        return TAS::boundedLevenshteinDistance(m_data, m_size, str.m_data, str.m_size, k);
+    }
+
+    /**
+     * @brief returns index of first occurence of substr with at most k edits
+     * if not found returns String::nPos
+     * 
+     * @param str 
+     * @param k 
+     * @return size_t 
+     */
+    size_t fuzzyFindFirst(BasicString const &str, size_t k) const {
+        return TAS::fuzzyFindFirst(m_data, m_size, str.m_data, str.m_size, k);
+    }
 };
 
 template<typename CharType>
 class StringIterator {
+    friend ConstStringIterator<CharType>;
     friend ReverseStringIterator<CharType>;
+    friend ConstReverseStringIterator<CharType>;
 
     CharType *m_ptr;
 
 public:
-    StringIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+#if __cplusplus >= 202002L
+    typedef std::contiguous_iterator_tag iterator_concept;
+#endif
+    typedef std::remove_const_t<CharType> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef CharType *pointer;
+    typedef CharType &reference;
+
+    StringIterator() : m_ptr(nullptr) {}
     
     StringIterator(CharType *ptr) : m_ptr(ptr) {}
     
@@ -804,7 +937,7 @@ public:
     }
 
     StringIterator(const ReverseStringIterator<CharType> &StringIterator) {
-        m_ptr = StringIterator.m_ptr;
+        m_ptr = StringIterator.m_ptr - 1;
     }
 
     /**
@@ -812,7 +945,7 @@ public:
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    void advance(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -821,7 +954,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    void retreat(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -835,12 +968,12 @@ public:
         return rhs.m_ptr - m_ptr;
     }
 
-    StringIterator &next(size_t n = 1) {
+    StringIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    StringIterator &prev(size_t n = 1) {
+    StringIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
@@ -849,23 +982,35 @@ public:
         return *m_ptr;
     }
 
-    StringIterator operator+(size_t n) const {
+    pointer operator->() const {
+        return m_ptr;
+    }
+
+    reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    StringIterator operator+(difference_type n) const {
         return StringIterator(m_ptr + n);
     }
 
-    StringIterator operator-(size_t n) const {
+    StringIterator operator-(difference_type n) const {
         return StringIterator(m_ptr - n);
     }
 
-    ptrdiff_t operator-(StringIterator<CharType> const &rhs) const {
-        return disctance(rhs);
+    difference_type operator-(StringIterator<CharType> const &rhs) const {
+        return -disctance(rhs);
     }
 
-    StringIterator &operator+=(size_t n) {
+    friend StringIterator operator+(difference_type n, StringIterator const &it) {
+        return it + n;
+    }
+
+    StringIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    StringIterator &operator-=(size_t n) {
+    StringIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
@@ -923,7 +1068,16 @@ class ConstStringIterator {
     CharType const *m_ptr;
 
 public:
-    ConstStringIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+#if __cplusplus >= 202002L
+    typedef std::contiguous_iterator_tag iterator_concept;
+#endif
+    typedef std::remove_const_t<CharType const> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef CharType const *pointer;
+    typedef CharType const &reference;
+
+    ConstStringIterator() : m_ptr(nullptr) {}
     
     ConstStringIterator(CharType const *ptr) : m_ptr(ptr) {}
     
@@ -936,11 +1090,11 @@ public:
     }
 
     ConstStringIterator(const ReverseStringIterator<CharType> &StringIterator) {
-        m_ptr = StringIterator.m_ptr;
+        m_ptr = StringIterator.m_ptr - 1;
     }
 
     ConstStringIterator(const ConstReverseStringIterator<CharType> &StringIterator) {
-        m_ptr = StringIterator.m_ptr;
+        m_ptr = StringIterator.m_ptr - 1;
     }
 
     /**
@@ -948,7 +1102,7 @@ public:
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    void advance(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -957,7 +1111,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    void retreat(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -971,12 +1125,12 @@ public:
         return rhs.m_ptr - m_ptr;
     }
 
-    ConstStringIterator &next(size_t n = 1) {
+    ConstStringIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    ConstStringIterator &prev(size_t n = 1) {
+    ConstStringIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
@@ -985,23 +1139,35 @@ public:
         return *m_ptr;
     }
 
-    ConstStringIterator operator+(size_t n) const {
+    pointer operator->() const {
+        return m_ptr;
+    }
+
+    reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    ConstStringIterator operator+(difference_type n) const {
         return ConstStringIterator(m_ptr + n);
     }
 
-    ConstStringIterator operator-(size_t n) const {
+    ConstStringIterator operator-(difference_type n) const {
         return ConstStringIterator(m_ptr - n);
     }
 
-    ptrdiff_t operator-(ConstStringIterator<CharType> const &rhs) const {
-        return disctance(rhs);
+    difference_type operator-(ConstStringIterator<CharType> const &rhs) const {
+        return -disctance(rhs);
+    }
+
+    friend ConstStringIterator operator+(difference_type n, ConstStringIterator const &it) {
+        return it + n;
     }
 
-    ConstStringIterator &operator+=(size_t n) {
+    ConstStringIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    ConstStringIterator &operator-=(size_t n) {
+    ConstStringIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
@@ -1057,11 +1223,20 @@ public:
 template<typename CharType>
 class ReverseStringIterator {
     friend StringIterator<CharType>;
+    friend ConstStringIterator<CharType>;
+    friend ConstReverseStringIterator<CharType>;
 
+    // points one past the referenced character, so rend() does not point before the string
     CharType *m_ptr;
 
 public:
-    ReverseStringIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef std::remove_const_t<CharType> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef CharType *pointer;
+    typedef CharType &reference;
+
+    ReverseStringIterator() : m_ptr(nullptr) {}
     
     ReverseStringIterator(CharType *ptr) : m_ptr(ptr) {}
     
@@ -1070,7 +1245,7 @@ public:
     }
 
     ReverseStringIterator(const StringIterator<CharType> &stringIterator) {
-        m_ptr = stringIterator.m_ptr;
+        m_ptr = stringIterator.m_ptr + 1;
     }
 
     /**
@@ -1078,7 +1253,7 @@ public:
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    void advance(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -1087,7 +1262,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    void retreat(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -1101,37 +1276,49 @@ public:
         return m_ptr - rhs.m_ptr;
     }
 
-    ReverseStringIterator &next(size_t n = 1) {
+    ReverseStringIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    ReverseStringIterator &prev(size_t n = 1) {
+    ReverseStringIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
 
     CharType &operator*() const {
-        return *m_ptr;
+        return *(m_ptr - 1);
+    }
+
+    pointer operator->() const {
+        return m_ptr - 1;
+    }
+
+    reference operator[](difference_type n) const {
+        return *(*this + n);
     }
 
-    ReverseStringIterator operator+(size_t n) const {
+    ReverseStringIterator operator+(difference_type n) const {
         return ReverseStringIterator(m_ptr - n);
     }
 
-    ReverseStringIterator operator-(size_t n) const {
+    ReverseStringIterator operator-(difference_type n) const {
         return ReverseStringIterator(m_ptr + n);
     }
 
-    ptrdiff_t operator-(ReverseStringIterator<CharType> const &rhs) const {
-        return disctance(rhs);
+    difference_type operator-(ReverseStringIterator<CharType> const &rhs) const {
+        return -disctance(rhs);
+    }
+
+    friend ReverseStringIterator operator+(difference_type n, ReverseStringIterator const &it) {
+        return it + n;
     }
 
-    ReverseStringIterator &operator+=(size_t n) {
+    ReverseStringIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    ReverseStringIterator &operator-=(size_t n) {
+    ReverseStringIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
@@ -1186,10 +1373,17 @@ class ConstReverseStringIterator {
     friend ConstStringIterator<CharType>;
     friend ReverseStringIterator<CharType>;
 
+    // points one past the referenced character, so rend() does not point before the string
     CharType const *m_ptr;
 
 public:
-    ConstReverseStringIterator() = delete;
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef std::remove_const_t<CharType const> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef CharType const *pointer;
+    typedef CharType const &reference;
+
+    ConstReverseStringIterator() : m_ptr(nullptr) {}
     
     ConstReverseStringIterator(CharType const *ptr) : m_ptr(ptr) {}
     
@@ -1202,11 +1396,11 @@ public:
     }
 
     ConstReverseStringIterator(const ConstStringIterator<CharType> &constStringIterator) {
-        m_ptr = constStringIterator.m_ptr;
+        m_ptr = constStringIterator.m_ptr + 1;
     }
 
     ConstReverseStringIterator(const StringIterator<CharType> &stringIterator) {
-        m_ptr = stringIterator.m_ptr;
+        m_ptr = stringIterator.m_ptr + 1;
     }
 
     /**
@@ -1214,7 +1408,7 @@ public:
      * 
      * @param n 
      */
-    void advance(size_t n = 1) {
+    void advance(difference_type n = 1) {
         m_ptr -= n;
     }
 
@@ -1223,7 +1417,7 @@ public:
      * 
      * @param n 
      */
-    void retreat(size_t n = 1) {
+    void retreat(difference_type n = 1) {
         m_ptr += n;
     }
 
@@ -1237,37 +1431,49 @@ public:
         return m_ptr - rhs.m_ptr;
     }
 
-    ConstReverseStringIterator &next(size_t n = 1) {
+    ConstReverseStringIterator &next(difference_type n = 1) {
         advance(n);
         return *this;
     }
 
-    ConstReverseStringIterator &prev(size_t n = 1) {
+    ConstReverseStringIterator &prev(difference_type n = 1) {
         retreat(n);
         return *this;
     }
 
     CharType const &operator*() const {
-        return *m_ptr;
+        return *(m_ptr - 1);
     }
 
-    ConstReverseStringIterator operator+(size_t n) const {
+    pointer operator->() const {
+        return m_ptr - 1;
+    }
+
+    reference operator[](difference_type n) const {
+        return *(*this + n);
+    }
+
+    ConstReverseStringIterator operator+(difference_type n) const {
         return ConstReverseStringIterator(m_ptr - n);
     }
 
-    ConstReverseStringIterator operator-(size_t n) const {
+    ConstReverseStringIterator operator-(difference_type n) const {
         return ConstReverseStringIterator(m_ptr + n);
     }
 
-    ptrdiff_t operator-(ConstReverseStringIterator<CharType> const &rhs) const {
-        return disctance(rhs);
+    difference_type operator-(ConstReverseStringIterator<CharType> const &rhs) const {
+        return -disctance(rhs);
     }
 
-    ConstReverseStringIterator &operator+=(size_t n) {
+    friend ConstReverseStringIterator operator+(difference_type n, ConstReverseStringIterator const &it) {
+        return it + n;
+    }
+
+    ConstReverseStringIterator &operator+=(difference_type n) {
         return next(n);
     }
 
-    ConstReverseStringIterator &operator-=(size_t n) {
+    ConstReverseStringIterator &operator-=(difference_type n) {
         return prev(n);
     }
 
@@ -1316,6 +1522,114 @@ public:
     }
 };
 
+/**
+ * @brief non-owning pointer + length view of characters, e.g. of a BasicString or of a memory mapped file.
+ * WARNING: the viewed characters must outlive the BasicStringRef
+ * 
+ * @tparam CharType type of the character
+ */
+template<typename CharType>
+class BasicStringRef {
+    CharType const *m_data{nullptr};
+    size_t m_size{};
+
+public:
+    BasicStringRef() = default;
+
+    BasicStringRef(CharType const *str, size_t n) : m_data(str), m_size(n) {}
+
+    BasicStringRef(CharType const *str) : m_data(str), m_size(cStringLength(str)) {}
+
+    template<size_t BlockSize>
+    BasicStringRef(BasicString<CharType, BlockSize> const &str) : m_data(str.cString()), m_size(str.size()) {}
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index 
+     */
+    const CharType &operator[](size_t index) const {
+        return m_data[index];
+    }
+
+    /**
+     * @brief raw char ptr, NOT null terminated
+     * 
+     * @return const CharType* 
+     */
+    const CharType *data() const {
+        return m_data;
+    }
+
+    bool empty() const {
+        return !m_size;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    size_t length() const {
+        return m_size;
+    }
+
+    ConstStringIterator<CharType> cbegin() const {
+        return m_data;
+    }
+
+    ConstStringIterator<CharType> cend() const {
+        return m_data + m_size;
+    }
+
+    /**
+     * @brief lazy Pipeline over the viewed characters
+     * 
+     * @return Pipeline 
+     */
+    auto view() const {
+        return pipelineOf(m_data, m_size);
+    }
+
+    /**
+     * @brief copies viewed characters into an owning string
+     * 
+     * @return BasicString<CharType> 
+     */
+    BasicString<CharType> toString() const {
+        BasicString<CharType> res(CharType{}, m_size);
+        memoryCopy(res.data(), m_data, m_size);
+        return res;
+    }
+
+    bool operator==(BasicStringRef const &rhs) const {
+        if(m_size != rhs.m_size) return false;
+        for (size_t i = 0; i < m_size; i++)
+        {
+            if(m_data[i] != rhs.m_data[i]) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(BasicStringRef const &rhs) const {
+        return !(*this == rhs);
+    }
+
+    /**
+     * @brief lexicographical comparison, characters are compared as unsigned values
+     * 
+     * @param rhs 
+     */
+    bool operator<(BasicStringRef const &rhs) const {
+        typedef std::make_unsigned_t<CharType> UnsignedChar;
+        size_t n = m_size < rhs.m_size ? m_size : rhs.m_size;
+        for (size_t i = 0; i < n; i++)
+        {
+            if(m_data[i] != rhs.m_data[i]) return static_cast<UnsignedChar>(m_data[i]) < static_cast<UnsignedChar>(rhs.m_data[i]);
+        }
+        return m_size < rhs.m_size;
+    }
+};
+
 //TYPEDEFS
 /**
  * @brief most common string type.
@@ -1323,6 +1637,12 @@ public:
  * 
  */
 typedef BasicString<char, 32> String;
+
+/**
+ * @brief Typedef of TAS::BasicStringRef<char>
+ * 
+ */
+typedef BasicStringRef<char> StringRef;
 //TYPEDEFS
 
 template<typename CharType>
@@ -1342,11 +1662,344 @@ void memoryCopy(PointerContainerType *destination, PointerContainerType const *s
     }
 }
 
+/**
+ * @brief appends to result the indices of all occurences of needle in haystack, shifted by base
+ * 
+ * @tparam CharType 
+ * @param haystack 
+ * @param n haystack length
+ * @param needle 
+ * @param m needle length
+ * @param result 
+ * @param base 
+ */
+template<typename CharType>
+void findAllInRange(CharType const *haystack, size_t n, CharType const *needle, size_t m, std::vector<size_t> &result, size_t base) {
+    if(m == 0 || m > n) return;
+
+    CharType const *last = haystack + (n - m);
+    CharType const *pos = haystack;
+    while(pos <= last) {
+        if constexpr (sizeof(CharType) == 1) {
+            pos = static_cast<CharType const *>(memchr(pos, static_cast<unsigned char>(needle[0]), last - pos + 1));
+            if(!pos) return;
+            if(memcmp(pos + 1, needle + 1, m - 1) == 0) result.push_back(base + (pos - haystack));
+        } else {
+            bool res = true;
+            for (size_t j = 0; j < m; j++)
+            {
+                if(pos[j] != needle[j]) {
+                    res = false;
+                    break;
+                }
+            }
+            if(res) result.push_back(base + (pos - haystack));
+        }
+        pos++;
+    }
+}
+
+/**
+ * @brief minimal amount of characters given to one thread by parallelFindAll
+ * 
+ */
+static const size_t parallelFindAllMinChunk{1 << 20};
+
+/**
+ * @brief returns indices of all occurences of needle in haystack in ascending order.
+ * haystack is split into chunks overlapping by m - 1 characters, which are searched concurrently.
+ * Works on any raw range, e.g. memory mapped file.
+ * if threads is 0 std::thread::hardware_concurrency() is used
+ * 
+ * @tparam CharType 
+ * @param haystack 
+ * @param n haystack length
+ * @param needle 
+ * @param m needle length
+ * @param threads 
+ * @return std::vector<size_t> 
+ */
+template<typename CharType>
+std::vector<size_t> parallelFindAll(CharType const *haystack, size_t n, CharType const *needle, size_t m, size_t threads) {
+    std::vector<size_t> res;
+    if(m == 0 || m > n) return res;
+
+    if(threads == 0) threads = std::thread::hardware_concurrency();
+    if(threads == 0) threads = 1;
+    size_t starts = n - m + 1;
+    if(threads > starts / parallelFindAllMinChunk) threads = starts / parallelFindAllMinChunk;
+
+    if(threads <= 1) {
+        findAllInRange(haystack, n, needle, m, res, 0);
+        return res;
+    }
+
+    // every chunk owns the occurences starting inside it, so it has to see m - 1 characters of the next one
+    size_t chunk = (starts + threads - 1) / threads;
+    std::vector<std::vector<size_t>> partial(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; t++)
+    {
+        size_t first = t * chunk;
+        if(first >= starts) break;
+        size_t ownedStarts = (starts - first < chunk) ? starts - first : chunk;
+        workers.emplace_back([=, &partial]() {
+            findAllInRange(haystack + first, ownedStarts + m - 1, needle, m, partial[t], first);
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    size_t total{};
+    for (std::vector<size_t> const &p : partial) {
+        total += p.size();
+    }
+    res.reserve(total);
+    for (std::vector<size_t> const &p : partial) {
+        res.insert(res.end(), p.begin(), p.end());
+    }
+    return res;
+}
+
+/**
+ * @brief Peq bit masks of a pattern for Myers' bit-parallel edit distance:
+ * bit i of block b of row(c) is set if pattern[64 * b + i] == c
+ * 
+ * @tparam CharType 
+ */
+template<typename CharType>
+class PatternBitMasks {
+    size_t m_blocks{};
+    std::vector<CharType> m_chars;
+    std::vector<uint64_t> m_masks;
+
+public:
+    PatternBitMasks(CharType const *pattern, size_t m, bool reversed = false) : m_blocks((m + 63) / 64) {
+        if constexpr (sizeof(CharType) == 1) {
+            m_masks.assign(256 * m_blocks, 0);
+            for (size_t i = 0; i < m; i++)
+            {
+                unsigned char c = static_cast<unsigned char>(pattern[reversed ? m - 1 - i : i]);
+                m_masks[c * m_blocks + i / 64] |= uint64_t(1) << (i % 64);
+            }
+        } else {
+            m_chars.assign(pattern, pattern + m);
+            std::sort(m_chars.begin(), m_chars.end());
+            m_chars.erase(std::unique(m_chars.begin(), m_chars.end()), m_chars.end());
+            // last row stays zero for characters that do not occur in the pattern
+            m_masks.assign((m_chars.size() + 1) * m_blocks, 0);
+            for (size_t i = 0; i < m; i++)
+            {
+                CharType c = pattern[reversed ? m - 1 - i : i];
+                size_t index = std::lower_bound(m_chars.begin(), m_chars.end(), c) - m_chars.begin();
+                m_masks[index * m_blocks + i / 64] |= uint64_t(1) << (i % 64);
+            }
+        }
+    }
+
+    size_t blocks() const {
+        return m_blocks;
+    }
+
+    uint64_t const *row(CharType c) const {
+        if constexpr (sizeof(CharType) == 1) {
+            return m_masks.data() + static_cast<unsigned char>(c) * m_blocks;
+        } else {
+            typename std::vector<CharType>::const_iterator it = std::lower_bound(m_chars.begin(), m_chars.end(), c);
+            if(it == m_chars.end() || *it != c) return m_masks.data() + m_chars.size() * m_blocks;
+            return m_masks.data() + (it - m_chars.begin()) * m_blocks;
+        }
+    }
+};
+
+/**
+ * @brief advances one 64 row block of Myers' bit-parallel edit distance by one text character (Hyyrö's formulation)
+ * 
+ * @param pv positive vertical deltas
+ * @param mv negative vertical deltas
+ * @param eq pattern match mask of the text character
+ * @param hin horizontal delta entering the block from above
+ * @param highBit bit of the last row of the block
+ * @return int horizontal delta leaving the block from below
+ */
+inline int myersAdvanceBlock(uint64_t &pv, uint64_t &mv, uint64_t eq, int hin, uint64_t highBit) {
+    uint64_t xv = eq | mv;
+    if(hin < 0) eq |= 1;
+    uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+    int hout = (ph & highBit) ? 1 : ((mh & highBit) ? -1 : 0);
+    ph <<= 1;
+    mh <<= 1;
+    if(hin < 0) mh |= 1;
+    else if(hin > 0) ph |= 1;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+    return hout;
+}
+
+/**
+ * @brief Myers' bit-parallel distance between pattern (rows) and text (columns).
+ * with topRowDelta == 1 it is the Levenshtein distance, with 0 the best match of pattern ending at each text position.
+ * calls onColumn(j, score) after every text character, stops when it returns false
+ * 
+ * @return size_t score after the last processed column
+ */
+template<typename CharType, typename Callback>
+size_t myersScan(PatternBitMasks<CharType> const &peq, size_t m, CharType const *text, size_t n, int topRowDelta, ptrdiff_t step, Callback const &onColumn) {
+    size_t score = m;
+    size_t blocks = peq.blocks();
+    uint64_t lastHighBit = uint64_t(1) << ((m - 1) % 64);
+
+    if(blocks == 1) {
+        uint64_t pv = ~uint64_t(0);
+        uint64_t mv = 0;
+        for (size_t j = 0; j < n; j++)
+        {
+            score += myersAdvanceBlock(pv, mv, peq.row(text[static_cast<ptrdiff_t>(j) * step])[0], topRowDelta, lastHighBit);
+            if(!onColumn(j, score)) break;
+        }
+        return score;
+    }
+
+    std::vector<uint64_t> pv(blocks, ~uint64_t(0));
+    std::vector<uint64_t> mv(blocks, 0);
+    for (size_t j = 0; j < n; j++)
+    {
+        uint64_t const *eq = peq.row(text[static_cast<ptrdiff_t>(j) * step]);
+        int carry = topRowDelta;
+        for (size_t b = 0; b + 1 < blocks; b++)
+        {
+            carry = myersAdvanceBlock(pv[b], mv[b], eq[b], carry, uint64_t(1) << 63);
+        }
+        score += myersAdvanceBlock(pv[blocks - 1], mv[blocks - 1], eq[blocks - 1], carry, lastHighBit);
+        if(!onColumn(j, score)) break;
+    }
+    return score;
+}
+
+/**
+ * @brief Levenshtein distance computed with Myers' bit-parallel algorithm,
+ * O(n * ceil(m / 64)) where m is the length of the shorter string
+ * 
+ * @tparam CharType 
+ * @param a 
+ * @param n a length
+ * @param b 
+ * @param m b length
+ * @return size_t 
+ */
+template<typename CharType>
+size_t levenshteinDistance(CharType const *a, size_t n, CharType const *b, size_t m) {
+    return boundedLevenshteinDistance(a, n, b, m, SIZE_MAX - 1);
+}
+
+/**
+ * @brief Levenshtein distance if it is <= k, otherwise k + 1.
+ * Gives up as soon as the remaining characters can not bring the distance back under k
+ * 
+ * @tparam CharType 
+ * @param a 
+ * @param n a length
+ * @param b 
+ * @param m b length
+ * @param k 
+ * @return size_t 
+ */
+template<typename CharType>
+size_t boundedLevenshteinDistance(CharType const *a, size_t n, CharType const *b, size_t m, size_t k) {
+    if(n < m) {
+        std::swap(a, b);
+        std::swap(n, m);
+    }
+    if(n - m > k) return k + 1;
+    if(m == 0) return n;
+
+    if constexpr (sizeof(CharType) == 1) {
+        if(m <= 64) {
+            // only the entries of characters that actually occur are cleared
+            uint64_t peq[256];
+            for (size_t j = 0; j < n; j++) peq[static_cast<unsigned char>(a[j])] = 0;
+            for (size_t i = 0; i < m; i++) peq[static_cast<unsigned char>(b[i])] = 0;
+            for (size_t i = 0; i < m; i++) peq[static_cast<unsigned char>(b[i])] |= uint64_t(1) << i;
+
+            uint64_t pv = ~uint64_t(0);
+            uint64_t mv = 0;
+            uint64_t highBit = uint64_t(1) << (m - 1);
+            size_t score = m;
+            for (size_t j = 0; j < n; j++)
+            {
+                score += myersAdvanceBlock(pv, mv, peq[static_cast<unsigned char>(a[j])], 1, highBit);
+                if(score > k && score - k > n - j - 1) return k + 1;
+            }
+            return score;
+        }
+    }
+
+    PatternBitMasks<CharType> peq(b, m);
+    bool exceeded = false;
+    size_t score = myersScan(peq, m, a, n, 1, 1, [&](size_t j, size_t score) {
+        exceeded = score > k && score - k > n - j - 1;
+        return !exceeded;
+    });
+    return exceeded ? k + 1 : score;
+}
+
+/**
+ * @brief returns index of first occurence of pattern in text with at most k edits
+ * (the one that ends first, and the shortest one of those).
+ * if not found returns SIZE_MAX
+ * 
+ * @tparam CharType 
+ * @param text 
+ * @param n text length
+ * @param pattern 
+ * @param m pattern length
+ * @param k 
+ * @return size_t 
+ */
+template<typename CharType>
+size_t fuzzyFindFirst(CharType const *text, size_t n, CharType const *pattern, size_t m, size_t k) {
+    if(m <= k) return 0;
+
+    size_t end = SIZE_MAX;
+    PatternBitMasks<CharType> peq(pattern, m);
+    myersScan(peq, m, text, n, 0, 1, [&](size_t j, size_t score) {
+        if(score <= k) end = j;
+        return score > k;
+    });
+    if(end == SIZE_MAX) return SIZE_MAX;
+
+    // the start is found by matching the reversed pattern against the text read backwards from end
+    size_t window = (end + 1 < m + k) ? end + 1 : m + k;
+    size_t best = SIZE_MAX;
+    size_t length{};
+    PatternBitMasks<CharType> reversed(pattern, m, true);
+    myersScan(reversed, m, text + end, window, 1, -1, [&](size_t j, size_t score) {
+        if(score < best) {
+            best = score;
+            length = j + 1;
+        }
+        return true;
+    });
+    return end + 1 - length;
+}
+
 template<typename CharType, size_t BlockSize>
 void print(BasicString<CharType, BlockSize> const &str) {
     std::cout << str.cString();
 }
 
+template<typename CharType>
+void print(BasicStringRef<CharType> const &str) {
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        std::cout << str[i];
+    }
+}
+
 template<typename CharType, size_t BlockSize>
 std::istream &operator>>(std::istream &is, BasicString<CharType, BlockSize> &str) {
     //FIXME:
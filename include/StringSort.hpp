@@ -0,0 +1,245 @@
+/**
+ * @file StringSort.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains string specialized sorting (multikey quicksort with cached characters)
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <String.hpp>
+
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace TAS
+{
+
+/**
+ * @brief buckets smaller than this are sorted by insertion sort
+ * 
+ */
+static const size_t stringSortInsertionThreshold{16};
+
+/**
+ * @brief sorting record of one string. key caches the characters of the string
+ * starting at the current depth, so most comparisons do not touch the string itself
+ * 
+ * @tparam CharType
+ */
+template<typename CharType>
+struct StringSortEntry {
+    uint64_t key;
+    CharType const *str;
+    size_t size;
+    size_t index;
+};
+
+/**
+ * @brief amount of characters packed into one cached key
+ * 
+ * @tparam CharType
+ */
+template<typename CharType>
+constexpr size_t stringSortKeyChars() {
+    return sizeof(uint64_t) / sizeof(CharType);
+}
+
+/**
+ * @brief packs characters [depth, depth + stringSortKeyChars) big-endian into an integer, missing ones are zero
+ * 
+ * @tparam CharType
+ */
+template<typename CharType>
+uint64_t stringSortKey(CharType const *str, size_t size, size_t depth) {
+    typedef std::make_unsigned_t<CharType> UnsignedChar;
+    constexpr size_t keyChars = stringSortKeyChars<CharType>();
+    constexpr size_t bits = sizeof(CharType) * 8;
+
+    uint64_t key{};
+    for (size_t i = 0; i < keyChars; i++)
+    {
+        key <<= bits % 64;
+        if(depth + i < size) key |= static_cast<UnsignedChar>(str[depth + i]);
+    }
+    return key;
+}
+
+/**
+ * @brief lexicographical less of two strings that are known to be equal before depth
+ * 
+ */
+template<typename CharType>
+bool stringSortLess(StringSortEntry<CharType> const &a, StringSortEntry<CharType> const &b, size_t depth) {
+    if(a.key != b.key) return a.key < b.key;
+
+    typedef std::make_unsigned_t<CharType> UnsignedChar;
+    size_t n = a.size < b.size ? a.size : b.size;
+    for (size_t i = depth; i < n; i++)
+    {
+        if(a.str[i] != b.str[i]) return static_cast<UnsignedChar>(a.str[i]) < static_cast<UnsignedChar>(b.str[i]);
+    }
+    return a.size < b.size;
+}
+
+template<typename CharType>
+void stringSortInsertion(StringSortEntry<CharType> *a, size_t n, size_t depth) {
+    for (size_t i = 1; i < n; i++)
+    {
+        StringSortEntry<CharType> tmp = a[i];
+        size_t j = i;
+        for (; j > 0 && stringSortLess(tmp, a[j - 1], depth); j--)
+        {
+            a[j] = a[j - 1];
+        }
+        a[j] = tmp;
+    }
+}
+
+template<typename CharType>
+void stringSortBucket(StringSortEntry<CharType> *a, size_t n, size_t depth);
+
+/**
+ * @brief three way partitioning on the cached keys, keys have to be valid for depth
+ * 
+ */
+template<typename CharType>
+void stringSortPartition(StringSortEntry<CharType> *a, size_t n, size_t depth) {
+    constexpr size_t keyChars = stringSortKeyChars<CharType>();
+
+    while(n >= stringSortInsertionThreshold) {
+        uint64_t x = a[0].key, y = a[n / 2].key, z = a[n - 1].key;
+        uint64_t pivot = (x < y) ? ((y < z) ? y : ((x < z) ? z : x)) : ((x < z) ? x : ((y < z) ? z : y));
+
+        // [0, lt) < pivot, [lt, i) == pivot, [gt, n) > pivot
+        size_t lt = 0, i = 0, gt = n;
+        while(i < gt) {
+            if(a[i].key < pivot) std::swap(a[lt++], a[i++]);
+            else if(a[i].key > pivot) std::swap(a[i], a[--gt]);
+            else i++;
+        }
+
+        // strings that end inside the key are prefixes of the rest of the bucket, shorter ones first
+        StringSortEntry<CharType> *eq = a + lt;
+        size_t eqSize = gt - lt;
+        size_t finished = 0;
+        for (size_t j = 0; j < eqSize; j++)
+        {
+            if(eq[j].size <= depth + keyChars) std::swap(eq[finished++], eq[j]);
+        }
+        // their sizes lie in [depth, depth + keyChars], so one pass per size orders them in O(n)
+        size_t placed = 0;
+        for (size_t size = depth; size <= depth + keyChars && placed < finished; size++)
+        {
+            for (size_t j = placed; j < finished; j++)
+            {
+                if(eq[j].size == size) std::swap(eq[placed++], eq[j]);
+            }
+        }
+        stringSortBucket(eq + finished, eqSize - finished, depth + keyChars);
+
+        // recurses into the smaller side and loops on the larger one, so the stack stays O(log n) deep
+        if(lt < n - gt) {
+            stringSortPartition(a, lt, depth);
+            a += gt;
+            n -= gt;
+        } else {
+            stringSortPartition(a + gt, n - gt, depth);
+            n = lt;
+        }
+    }
+    stringSortInsertion(a, n, depth);
+}
+
+/**
+ * @brief sorts strings that are equal before depth
+ * 
+ */
+template<typename CharType>
+void stringSortBucket(StringSortEntry<CharType> *a, size_t n, size_t depth) {
+    if(n < 2) return;
+    for (size_t i = 0; i < n; i++)
+    {
+        a[i].key = stringSortKey(a[i].str, a[i].size, depth);
+    }
+    stringSortPartition(a, n, depth);
+}
+
+template<typename CharType, size_t BlockSize>
+CharType const *stringSortData(BasicString<CharType, BlockSize> const &str) {
+    return str.cString();
+}
+
+template<typename CharType>
+CharType const *stringSortData(BasicStringRef<CharType> const &str) {
+    return str.data();
+}
+
+template<typename CharType, size_t BlockSize>
+void stringSortSwap(BasicString<CharType, BlockSize> &a, BasicString<CharType, BlockSize> &b) {
+    a.swap(b);
+}
+
+template<typename CharType>
+void stringSortSwap(BasicStringRef<CharType> &a, BasicStringRef<CharType> &b) {
+    std::swap(a, b);
+}
+
+/**
+ * @brief sorts contiguous range of BasicString or BasicStringRef lexicographically
+ * (characters compared as unsigned values) using multikey quicksort
+ * 
+ * @tparam StringType BasicString or BasicStringRef
+ * @param first
+ * @param last
+ */
+template<typename StringType>
+void stringSort(StringType *first, StringType *last) {
+    typedef std::remove_const_t<std::remove_pointer_t<decltype(stringSortData(*first))>> CharType;
+
+    size_t n = last - first;
+    std::vector<StringSortEntry<CharType>> entries(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        entries[i] = {0, stringSortData(first[i]), first[i].size(), i};
+    }
+    stringSortBucket(entries.data(), n, 0);
+
+    // applies the permutation cycle by cycle, so every string is swapped (not copied) into place
+    std::vector<size_t> position(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        position[entries[i].index] = i;
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        while(position[i] != i) {
+            size_t target = position[i];
+            stringSortSwap(first[i], first[target]);
+            std::swap(position[i], position[target]);
+        }
+    }
+}
+
+/**
+ * @brief sorts Array of BasicString or BasicStringRef lexicographically
+ * 
+ * @tparam StringType BasicString or BasicStringRef
+ * @tparam Size
+ * @param arr
+ * @return Array<StringType, Size>&
+ */
+template<typename StringType, size_t Size>
+Array<StringType, Size> &stringSort(Array<StringType, Size> &arr) {
+    stringSort(arr.data(), arr.data() + Size);
+    return arr;
+}
+
+} // namespace TAS
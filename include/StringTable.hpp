@@ -0,0 +1,412 @@
+/**
+ * @file StringTable.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the BasicStringTable and BasicStringTableView classes
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <String.hpp>
+#include <Vector.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace TAS
+{
+
+/**
+ * @brief header of a serialized string table, followed by size + 1 offsets (uint64_t) and the characters.
+ * All numbers are in the byte order of the machine that wrote them
+ * 
+ */
+struct StringTableHeader {
+    char magic[8];
+    uint64_t charSize;
+    uint64_t size;
+    uint64_t charCount;
+};
+
+/**
+ * @brief first bytes of a serialized string table, the last one is the format version
+ * 
+ */
+inline constexpr char stringTableMagic[8] = {'T', 'A', 'S', 'S', 'T', 'A', 'B', 1};
+
+/**
+ * @brief read only string table over characters and offsets it does not own, e.g. over a memory mapped file.
+ * String i is chars[offsets[i], offsets[i + 1]).
+ * WARNING: the viewed memory must outlive the view
+ * 
+ * @tparam CharType type of the character
+ */
+template<typename CharType>
+class BasicStringTableView {
+    CharType const *m_chars{nullptr};
+    uint64_t const *m_offsets{nullptr};
+    size_t m_size{};
+
+public:
+    BasicStringTableView() = default;
+
+    /**
+     * @brief Construct a new Basic String Table View object over size strings
+     * 
+     * @param chars
+     * @param offsets size + 1 ascending offsets into chars, starting with 0
+     * @param size
+     */
+    BasicStringTableView(CharType const *chars, uint64_t const *offsets, size_t size) : m_chars(chars), m_offsets(offsets), m_size(size) {}
+
+    /**
+     * @brief view over bytes written by BasicStringTable::serialize, nothing is copied.
+     * bytes must be aligned to 8 bytes (memory mapped files are page aligned).
+     * If the header, the character size, the total size or the offsets do not match throws std::invalid_argument
+     * 
+     * @param bytes
+     * @param n amount of bytes
+     * @return BasicStringTableView
+     */
+    static BasicStringTableView fromBytes(void const *bytes, size_t n) {
+        if(reinterpret_cast<uintptr_t>(bytes) % alignof(uint64_t) != 0) throw std::invalid_argument("String table bytes are not aligned to 8 bytes");
+        if(n < sizeof(StringTableHeader)) throw std::invalid_argument("String table is truncated");
+        StringTableHeader header;
+        memcpy(&header, bytes, sizeof(header));
+        if(memcmp(header.magic, stringTableMagic, sizeof(stringTableMagic)) != 0) throw std::invalid_argument("Bytes are not a string table");
+        if(header.charSize != sizeof(CharType)) throw std::invalid_argument("String table has another character size");
+        if(header.size >= (n - sizeof(header)) / sizeof(uint64_t)) throw std::invalid_argument("String table is truncated");
+        size_t offsetBytes = (header.size + 1) * sizeof(uint64_t);
+        if(header.charCount > (n - sizeof(header) - offsetBytes) / sizeof(CharType)) throw std::invalid_argument("String table is truncated");
+
+        unsigned char const *data = static_cast<unsigned char const *>(bytes);
+        BasicStringTableView res(reinterpret_cast<CharType const *>(data + sizeof(header) + offsetBytes),
+            reinterpret_cast<uint64_t const *>(data + sizeof(header)), header.size);
+        // ascending offsets from 0 to charCount keep every string inside the characters
+        if(res.m_offsets[0] != 0 || res.m_offsets[header.size] != header.charCount) throw std::invalid_argument("String table offsets are corrupted");
+        for (size_t i = 0; i < header.size; i++)
+        {
+            if(res.m_offsets[i + 1] < res.m_offsets[i]) throw std::invalid_argument("String table offsets are corrupted");
+        }
+        return res;
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return BasicStringRef<CharType>
+     */
+    BasicStringRef<CharType> operator[](size_t index) const {
+        return BasicStringRef<CharType>(m_chars + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return BasicStringRef<CharType>
+     */
+    BasicStringRef<CharType> at(size_t index) const {
+        if(index >= m_size) throw std::out_of_range("Index is out of range");
+        return (*this)[index];
+    }
+
+    /**
+     * @brief index of the first string equal to str, size() if there is none
+     * 
+     * @param str
+     * @return size_t
+     */
+    size_t indexOf(BasicStringRef<CharType> const &str) const {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            if((*this)[i] == str) return i;
+        }
+        return m_size;
+    }
+
+    bool contains(BasicStringRef<CharType> const &str) const {
+        return indexOf(str) != m_size;
+    }
+
+    bool empty() const {
+        return !m_size;
+    }
+
+    /**
+     * @brief amount of strings
+     * 
+     * @return size_t
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief amount of characters of all strings
+     * 
+     * @return size_t
+     */
+    size_t charCount() const {
+        return m_size ? m_offsets[m_size] : 0;
+    }
+
+    /**
+     * @brief all characters, NOT null terminated
+     * 
+     * @return CharType const*
+     */
+    CharType const *chars() const {
+        return m_chars;
+    }
+
+    uint64_t const *offsets() const {
+        return m_offsets;
+    }
+
+    /**
+     * @brief Applies Lambda to every string in order, walking the characters sequentially
+     * 
+     * @tparam Function callable as void(BasicStringRef<CharType>)
+     * @param f
+     */
+    template<typename Function>
+    BasicStringTableView const &forEach(Function &&f) const {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            f((*this)[i]);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda to every string in order
+     * 
+     * @tparam Function callable as void(BasicStringRef<CharType>, size_t)
+     * @param f
+     */
+    template<typename Function>
+    BasicStringTableView const &forEachWithIndex(Function &&f) const {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            f((*this)[i], i);
+        }
+        return *this;
+    }
+};
+
+/**
+ * @brief append only collection of strings packed into one character buffer plus an offsets array,
+ * so a string costs its characters and 8 bytes instead of a separate heap block.
+ * Strings are read as BasicStringRef, which stay valid until the next append.
+ * serialize() writes a form that BasicStringTableView::fromBytes reads in place
+ * 
+ * @tparam CharType type of the character
+ */
+template<typename CharType>
+class BasicStringTable {
+    Vector<CharType> m_chars;
+    Vector<uint64_t> m_offsets{0};
+
+public:
+    BasicStringTable() = default;
+
+    /**
+     * @brief Construct a new Basic String Table object from std::initializer_list
+     * 
+     * @param val
+     */
+    BasicStringTable(std::initializer_list<BasicStringRef<CharType>> const &val) {
+        for (BasicStringRef<CharType> const &str : val) {
+            append(str);
+        }
+    }
+
+    /**
+     * @brief makes room for the given amount of strings with chars characters in total
+     * 
+     * @param strings
+     * @param chars
+     */
+    BasicStringTable &reserve(size_t strings, size_t chars) {
+        m_offsets.reserve(strings + 1);
+        m_chars.reserve(chars);
+        return *this;
+    }
+
+    /**
+     * @brief copies str to the end of the table, str may be a string of this table
+     * 
+     * @param str
+     * @return size_t index of the appended string
+     */
+    size_t append(BasicStringRef<CharType> const &str) {
+        m_chars.append(str.data(), str.size());
+        m_offsets.pushBack(m_chars.size());
+        return m_offsets.size() - 2;
+    }
+
+    /**
+     * @brief removes all strings and keeps the capacity
+     * 
+     */
+    BasicStringTable &clear() {
+        m_chars.clear();
+        m_offsets.resize(1);
+        return *this;
+    }
+
+    /**
+     * @brief read only view of the table, valid until the next append
+     * 
+     * @return BasicStringTableView<CharType>
+     */
+    BasicStringTableView<CharType> view() const {
+        return BasicStringTableView<CharType>(m_chars.data(), m_offsets.data(), size());
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return BasicStringRef<CharType>
+     */
+    BasicStringRef<CharType> operator[](size_t index) const {
+        return BasicStringRef<CharType>(m_chars.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return BasicStringRef<CharType>
+     */
+    BasicStringRef<CharType> at(size_t index) const {
+        return view().at(index);
+    }
+
+    /**
+     * @brief index of the first string equal to str, size() if there is none
+     * 
+     * @param str
+     * @return size_t
+     */
+    size_t indexOf(BasicStringRef<CharType> const &str) const {
+        return view().indexOf(str);
+    }
+
+    bool contains(BasicStringRef<CharType> const &str) const {
+        return view().contains(str);
+    }
+
+    bool empty() const {
+        return m_offsets.size() == 1;
+    }
+
+    /**
+     * @brief amount of strings
+     * 
+     * @return size_t
+     */
+    size_t size() const {
+        return m_offsets.size() - 1;
+    }
+
+    /**
+     * @brief amount of characters of all strings
+     * 
+     * @return size_t
+     */
+    size_t charCount() const {
+        return m_chars.size();
+    }
+
+    /**
+     * @brief Applies Lambda to every string in order, walking the characters sequentially
+     * 
+     * @tparam Function callable as void(BasicStringRef<CharType>)
+     * @param f
+     */
+    template<typename Function>
+    BasicStringTable const &forEach(Function &&f) const {
+        view().forEach(f);
+        return *this;
+    }
+
+    /**
+     * @brief Applies Lambda to every string in order
+     * 
+     * @tparam Function callable as void(BasicStringRef<CharType>, size_t)
+     * @param f
+     */
+    template<typename Function>
+    BasicStringTable const &forEachWithIndex(Function &&f) const {
+        view().forEachWithIndex(f);
+        return *this;
+    }
+
+    /**
+     * @brief amount of bytes written by serialize
+     * 
+     * @return size_t
+     */
+    size_t serializedSize() const {
+        return sizeof(StringTableHeader) + m_offsets.size() * sizeof(uint64_t) + m_chars.size() * sizeof(CharType);
+    }
+
+    /**
+     * @brief writes serializedSize() bytes to out: header, offsets, characters.
+     * Offsets come first so they stay aligned when out is
+     * 
+     * @param out
+     */
+    BasicStringTable const &serialize(void *out) const {
+        StringTableHeader header;
+        memcpy(header.magic, stringTableMagic, sizeof(stringTableMagic));
+        header.charSize = sizeof(CharType);
+        header.size = size();
+        header.charCount = m_chars.size();
+        unsigned char *bytes = static_cast<unsigned char *>(out);
+        memcpy(bytes, &header, sizeof(header));
+        bytes += sizeof(header);
+        memcpy(bytes, m_offsets.data(), m_offsets.size() * sizeof(uint64_t));
+        bytes += m_offsets.size() * sizeof(uint64_t);
+        if(!m_chars.empty()) memcpy(bytes, m_chars.data(), m_chars.size() * sizeof(CharType));
+        return *this;
+    }
+
+    /**
+     * @brief serialized table in a new buffer, e.g. to be written to a file
+     * 
+     * @return Vector<unsigned char>
+     */
+    Vector<unsigned char> serialize() const {
+        Vector<unsigned char> res(serializedSize());
+        serialize(res.data());
+        return res;
+    }
+};
+
+//TYPEDEFS
+/**
+ * @brief Typedef of TAS::BasicStringTable<char>
+ * 
+ */
+typedef BasicStringTable<char> StringTable;
+
+/**
+ * @brief Typedef of TAS::BasicStringTableView<char>
+ * 
+ */
+typedef BasicStringTableView<char> StringTableView;
+//TYPEDEFS
+
+} // namespace TAS
@@ -83,6 +83,28 @@ std::cout << "\nInitializing anonymous test suite\n\n";
     SET_WHITE \
     test_count++;
 
+#define ASSERT_THROWS(expression, exception) \
+    { \
+        bool exceptionThrown = false; \
+        try { \
+            (void)(expression); \
+        } catch(exception const &) { \
+            exceptionThrown = true; \
+        } \
+        if(exceptionThrown) { \
+            SET_GREEN \
+            std::cout << "[V] Test_" << test_count << ": \"" << #expression << " throws " << #exception << "\" Passed!\n"; \
+            test_passed++; \
+        } \
+        else { \
+            SET_RED \
+            std::cout << "[X] Test_" << test_count << ": \"" << #expression << " throws " << #exception << "\" Failed!\n"; \
+            test_failed++; \
+        } \
+        SET_WHITE \
+        test_count++; \
+    }
+
 #define TEST_END \
 std::cout << "\nFrom " << test_count << " tests\n" << test_passed \
 << " Tests passed\n" << test_failed << " Tests failed\n";
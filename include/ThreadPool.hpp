@@ -0,0 +1,311 @@
+/**
+ * @file ThreadPool.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the ThreadPool class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Arrays with less elements than this are processed serially by the parallel functions
+ * 
+ */
+#ifndef TAS_PARALLEL_THRESHOLD
+#define TAS_PARALLEL_THRESHOLD (1 << 16)
+#endif
+
+namespace TAS
+{
+
+//Forwards
+template<typename T, size_t Size>
+class Array;
+//Forwards
+
+/**
+ * @brief fixed set of worker threads executing submitted tasks
+ * 
+ */
+class ThreadPool {
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stop{false};
+
+    /**
+     * @brief runs one queued task if there is any
+     * 
+     * @return true if a task was run
+     */
+    bool runPendingTask() {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_tasks.empty()) return false;
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+        task();
+        return true;
+    }
+
+public:
+    /**
+     * @brief Construct a new Thread Pool object with threads workers
+     * 
+     * @param threads
+     */
+    explicit ThreadPool(size_t threads) {
+        m_workers.reserve(threads);
+        for (size_t i = 0; i < threads; i++)
+        {
+            m_workers.emplace_back([this]() {
+                while(true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_condition.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+                        if(m_stop && m_tasks.empty()) return;
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool &operator=(ThreadPool const &) = delete;
+
+    /**
+     * @brief finishes queued tasks and joins the workers
+     * 
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        for (std::thread &worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief process wide pool with one worker less than hardware threads,
+     * because the thread calling parallelFor takes part in the work
+     * 
+     * @return ThreadPool&
+     */
+    static ThreadPool &global() {
+        static ThreadPool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+        return pool;
+    }
+
+    /**
+     * @brief amount of worker threads
+     * 
+     * @return size_t
+     */
+    size_t size() const {
+        return m_workers.size();
+    }
+
+    /**
+     * @brief queues task for execution on one of the workers
+     * 
+     * @tparam Function callable as void()
+     * @param task
+     */
+    template<typename Function>
+    void submit(Function &&task) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace(std::forward<Function>(task));
+        }
+        m_condition.notify_one();
+    }
+
+    /**
+     * @brief calls f(begin, end) for consecutive chunks of [first, last) of grain indices,
+     * on the workers and on the calling thread, and returns when all chunks are done.
+     * The first exception thrown by f is rethrown here
+     * 
+     * @tparam Function callable as void(size_t, size_t)
+     * @param first
+     * @param last
+     * @param grain
+     * @param f
+     */
+    template<typename Function>
+    void parallelFor(size_t first, size_t last, size_t grain, Function const &f) {
+        if(last <= first) return;
+        if(grain == 0) grain = 1;
+        size_t chunks = (last - first + grain - 1) / grain;
+        size_t helpers = chunks - 1 < m_workers.size() ? chunks - 1 : m_workers.size();
+        if(helpers == 0) {
+            f(first, last);
+            return;
+        }
+
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> running{helpers};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        auto work = [&]() {
+            for (size_t c = next.fetch_add(1); c < chunks; c = next.fetch_add(1))
+            {
+                try {
+                    size_t begin = first + c * grain;
+                    f(begin, last - begin < grain ? last : begin + grain);
+                } catch(...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if(!error) error = std::current_exception();
+                }
+            }
+        };
+
+        for (size_t i = 0; i < helpers; i++)
+        {
+            submit([&]() {
+                work();
+                running.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        work();
+
+        // helps with queued tasks instead of blocking, so nested parallelFor can not deadlock
+        while(running.load(std::memory_order_acquire) != 0) {
+            if(!runPendingTask()) std::this_thread::yield();
+        }
+        if(error) std::rethrow_exception(error);
+    }
+};
+
+/**
+ * @brief calls body(first, last) for chunks of the indices of size elements at data on ThreadPool::global().
+ * Chunk boundaries fall on cache line boundaries of data, so no two threads write to the same cache line
+ * 
+ * @param grain minimal amount of elements in one chunk, 0 picks one automatically
+ * @param body 
+ */
+template<typename T, typename Body>
+void parallelApply(T const *data, size_t size, size_t grain, Body const &body) {
+    const size_t lineSize = 64;
+    const size_t lineElements = sizeof(T) < lineSize ? lineSize / sizeof(T) : 1;
+
+    ThreadPool &pool = ThreadPool::global();
+    if(grain == 0) grain = size / (4 * (pool.size() + 1)) + 1;
+    grain = (grain + lineElements - 1) / lineElements * lineElements;
+
+    // elements before the first cache line boundary are given to the first chunk
+    size_t head{};
+    size_t misalignment = reinterpret_cast<uintptr_t>(data) % lineSize;
+    if(misalignment && lineSize % sizeof(T) == 0 && misalignment % sizeof(T) == 0) {
+        head = (lineSize - misalignment) / sizeof(T);
+        if(head > size) head = size;
+    }
+    size_t chunks = (size - head + grain - 1) / grain;
+    if(chunks == 0) chunks = 1;
+
+    pool.parallelFor(0, chunks, 1, [&](size_t firstChunk, size_t lastChunk) {
+        for (size_t c = firstChunk; c < lastChunk; c++)
+        {
+            size_t first = c == 0 ? 0 : head + c * grain;
+            size_t last = head + (c + 1) * grain < size ? head + (c + 1) * grain : size;
+            body(first, last);
+        }
+    });
+}
+
+/**
+ * @brief same as arr.forEach(f), but elements are split between threads of ThreadPool::global().
+ * Falls back to forEach for arrays smaller than TAS_PARALLEL_THRESHOLD.
+ * WARNING: f is called concurrently and in no particular order
+ * 
+ * @tparam Function callable as void(T const &)
+ * @param arr 
+ * @param f 
+ * @param grain minimal amount of elements in one chunk, 0 picks one automatically
+ */
+template<typename T, size_t Size, typename Function>
+Array<T, Size> const &parallelForEach(Array<T, Size> const &arr, Function &&f, size_t grain = 0) {
+    if(Size < TAS_PARALLEL_THRESHOLD || ThreadPool::global().size() == 0) return arr.forEach(f);
+    T const *data = arr.data();
+    parallelApply(data, Size, grain, [data, &f](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++)
+        {
+            f(data[i]);
+        }
+    });
+    return arr;
+}
+
+/**
+ * @brief same as arr.transformReference(f), but elements are split between threads of ThreadPool::global().
+ * Falls back to transformReference for arrays smaller than TAS_PARALLEL_THRESHOLD.
+ * WARNING: f is called concurrently and in no particular order
+ * 
+ * @tparam Function callable as void(T &)
+ * @param arr 
+ * @param f 
+ * @param grain minimal amount of elements in one chunk, 0 picks one automatically
+ */
+template<typename T, size_t Size, typename Function>
+Array<T, Size> &parallelTransformReference(Array<T, Size> &arr, Function &&f, size_t grain = 0) {
+    if(Size < TAS_PARALLEL_THRESHOLD || ThreadPool::global().size() == 0) return arr.transformReference(f);
+    T *data = arr.data();
+    parallelApply(data, Size, grain, [data, &f](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++)
+        {
+            f(data[i]);
+        }
+    });
+    return arr;
+}
+
+/**
+ * @brief same as arr.transformAndCopy(f), but elements are split between threads of ThreadPool::global().
+ * Falls back to transformAndCopy for arrays smaller than TAS_PARALLEL_THRESHOLD.
+ * WARNING: f is called concurrently and in no particular order
+ * 
+ * @tparam Function callable as T(T const &)
+ * @param arr 
+ * @param f 
+ * @param grain minimal amount of elements in one chunk, 0 picks one automatically
+ */
+template<typename T, size_t Size, typename Function>
+Array<T, Size> &parallelTransformAndCopy(Array<T, Size> &arr, Function &&f, size_t grain = 0) {
+    if(Size < TAS_PARALLEL_THRESHOLD || ThreadPool::global().size() == 0) return arr.transformAndCopy(f);
+    T *data = arr.data();
+    parallelApply(data, Size, grain, [data, &f](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++)
+        {
+            data[i] = f(data[i]);
+        }
+    });
+    return arr;
+}
+
+} // namespace TAS
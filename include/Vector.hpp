@@ -0,0 +1,683 @@
+/**
+ * @file Vector.hpp
+ * @author Soldatov Andrey (SoldatovAndreyWork@gmail.com)
+ * @brief This file contains the Vector class
+ * @version 0.1
+ * @date 2022-04-05
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <Print.hpp>
+
+#include <stdint.h>
+#include <string.h>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace TAS
+{
+
+/**
+ * @brief uninitialized storage for n objects of type T, over aligned types get their alignment
+ * 
+ * @tparam T
+ * @param n
+ * @return T*
+ */
+template<typename T>
+T *vectorAllocate(size_t n) {
+    if(n > SIZE_MAX / sizeof(T)) throw std::length_error("Vector is too large");
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    } else {
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+}
+
+/**
+ * @brief releases storage returned by vectorAllocate, the objects must already be destroyed
+ * 
+ * @tparam T
+ * @param data
+ */
+template<typename T>
+void vectorDeallocate(T *data) {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(data, std::align_val_t(alignof(T)));
+    } else {
+        ::operator delete(data);
+    }
+}
+
+template<typename T>
+void vectorDestroy(T *data, size_t n) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (size_t i = 0; i < n; i++)
+        {
+            data[i].~T();
+        }
+    }
+}
+
+/**
+ * @brief moves n objects from from to uninitialized to and destroys them in from.
+ * Trivially copyable types are moved with one memcpy. Types with a move constructor that may throw
+ * are copied instead, and from is left untouched if a copy throws
+ * 
+ * @tparam T
+ * @param from
+ * @param n
+ * @param to
+ */
+template<typename T>
+void vectorRelocate(T *from, size_t n, T *to) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if(n) memcpy(static_cast<void *>(to), static_cast<void const *>(from), n * sizeof(T));
+    } else if constexpr (std::is_nothrow_move_constructible<T>::value) {
+        for (size_t i = 0; i < n; i++)
+        {
+            new (to + i) T(std::move(from[i]));
+            from[i].~T();
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < n; i++)
+            {
+                new (to + i) T(std::move_if_noexcept(from[i]));
+            }
+        } catch(...) {
+            vectorDestroy(to, i);
+            throw;
+        }
+        vectorDestroy(from, n);
+    }
+}
+
+/**
+ * @brief copy constructs n objects from from in uninitialized to.
+ * Trivially copyable types are copied with one memcpy, nothing is left constructed in to if a copy throws
+ * 
+ * @tparam T
+ * @param from
+ * @param n
+ * @param to
+ */
+template<typename T>
+void vectorCopy(T const *from, size_t n, T *to) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if(n) memcpy(static_cast<void *>(to), static_cast<void const *>(from), n * sizeof(T));
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < n; i++)
+            {
+                new (to + i) T(from[i]);
+            }
+        } catch(...) {
+            vectorDestroy(to, i);
+            throw;
+        }
+    }
+}
+
+/**
+ * @brief capacity after growing from capacity to hold at least needed elements,
+ * it doubles so n pushBack calls relocate O(n) elements in total
+ * 
+ * @param capacity
+ * @param needed
+ * @return size_t
+ */
+inline size_t vectorGrowth(size_t capacity, size_t needed) {
+    size_t grown = capacity > SIZE_MAX / 2 ? SIZE_MAX : 2 * capacity;
+    if(grown < 4) grown = 4;
+    return grown < needed ? needed : grown;
+}
+
+/**
+ * @brief elements and operations shared by Vector and SmallVector, which differ only in their storage.
+ * Derived releases the storage with releaseStorage() and tells with ownsStorage() whether
+ * m_data was returned by vectorAllocate
+ * 
+ * @tparam Derived Vector or SmallVector
+ * @tparam T type
+ */
+template<typename Derived, typename T>
+class BasicVector {
+protected:
+    T *m_data{nullptr};
+    size_t m_size{};
+    size_t m_capacity{};
+
+    BasicVector() = default;
+
+    Derived &derived() {
+        return static_cast<Derived &>(*this);
+    }
+
+    Derived const &derived() const {
+        return static_cast<Derived const &>(*this);
+    }
+
+    void releaseStorage() {
+        if(derived().ownsStorage()) vectorDeallocate(m_data);
+    }
+
+    /**
+     * @brief moves the elements to new heap storage of capacity elements
+     * 
+     * @param capacity must not be less than m_size
+     */
+    void reallocate(size_t capacity) {
+        T *data = vectorAllocate<T>(capacity);
+        try {
+            vectorRelocate(m_data, m_size, data);
+        } catch(...) {
+            vectorDeallocate(data);
+            throw;
+        }
+        releaseStorage();
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    /**
+     * @brief emplaceBack into new storage of capacity elements. The new element is constructed before the old
+     * ones are relocated, so args may refer to elements of this vector
+     * 
+     */
+    template<typename... Args>
+    T &growAndEmplaceBack(size_t capacity, Args &&...args) {
+        T *data = vectorAllocate<T>(capacity);
+        try {
+            new (data + m_size) T(std::forward<Args>(args)...);
+        } catch(...) {
+            vectorDeallocate(data);
+            throw;
+        }
+        try {
+            vectorRelocate(m_data, m_size, data);
+        } catch(...) {
+            data[m_size].~T();
+            vectorDeallocate(data);
+            throw;
+        }
+        releaseStorage();
+        m_data = data;
+        m_capacity = capacity;
+        return m_data[m_size++];
+    }
+
+public:
+    /**
+     * @brief makes room for at least capacity elements, so pushing up to capacity elements does not relocate them
+     * 
+     * @param capacity
+     */
+    Derived &reserve(size_t capacity) {
+        if(capacity > m_capacity) reallocate(capacity);
+        return derived();
+    }
+
+    /**
+     * @brief constructs an element at the end from args, amortized O(1)
+     * 
+     * @tparam Args
+     * @param args constructor arguments of T
+     * @return T& the new element
+     */
+    template<typename... Args>
+    T &emplaceBack(Args &&...args) {
+        if(m_size == m_capacity) return growAndEmplaceBack(vectorGrowth(m_capacity, m_size + 1), std::forward<Args>(args)...);
+        new (m_data + m_size) T(std::forward<Args>(args)...);
+        return m_data[m_size++];
+    }
+
+    Derived &pushBack(T const &val) {
+        emplaceBack(val);
+        return derived();
+    }
+
+    Derived &pushBack(T &&val) {
+        emplaceBack(std::move(val));
+        return derived();
+    }
+
+    /**
+     * @brief removes the last element, if empty throws std::out_of_range
+     * 
+     */
+    Derived &popBack() {
+        if(m_size == 0) throw std::out_of_range("Vector is empty");
+        m_data[--m_size].~T();
+        return derived();
+    }
+
+    /**
+     * @brief destroys elements past size or appends copies of val up to size
+     * 
+     * @param size
+     * @param val
+     */
+    Derived &resize(size_t size, T const &val = T()) {
+        if(size < m_size) {
+            vectorDestroy(m_data + size, m_size - size);
+            m_size = size;
+            return derived();
+        }
+        if(size > m_capacity) {
+            // val may be an element of this vector: it is copied before the old storage is released, the rest copy the copy
+            T &first = growAndEmplaceBack(vectorGrowth(m_capacity, size), val);
+            while(m_size < size) {
+                emplaceBack(first);
+            }
+            return derived();
+        }
+        while(m_size < size) {
+            emplaceBack(val);
+        }
+        return derived();
+    }
+
+    /**
+     * @brief destroys all elements, capacity is kept
+     * 
+     */
+    Derived &clear() {
+        vectorDestroy(m_data, m_size);
+        m_size = 0;
+        return derived();
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return T&
+     */
+    T &at(size_t index) {
+        if(index >= m_size) throw std::out_of_range("Index is out of range");
+        return m_data[index];
+    }
+
+    /**
+     * @brief if out of range throws std::out_of_range
+     * 
+     * @param index
+     * @return T&
+     */
+    const T &at(size_t index) const {
+        if(index >= m_size) throw std::out_of_range("Index is out of range");
+        return m_data[index];
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return T&
+     */
+    T &operator[](size_t index) {
+        return m_data[index];
+    }
+
+    /**
+     * @brief WARNING: does not throw if exceedes
+     * 
+     * @param index
+     * @return T&
+     */
+    const T &operator[](size_t index) const {
+        return m_data[index];
+    }
+
+    /**
+     * @brief raw data ptr
+     * 
+     * @return T*
+     */
+    T *data() {
+        return m_data;
+    }
+
+    T const *data() const {
+        return m_data;
+    }
+
+    const T &front() const {
+        return m_data[0];
+    }
+
+    const T &back() const {
+        return m_data[m_size - 1];
+    }
+
+    T &front() {
+        return m_data[0];
+    }
+
+    T &back() {
+        return m_data[m_size - 1];
+    }
+
+    bool empty() const {
+        return !m_size;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    ArrayIterator<T> begin() {
+        return m_data;
+    }
+
+    ConstArrayIterator<T> cbegin() const {
+        return m_data;
+    }
+
+    ReverseArrayIterator<T> rbegin() {
+        return m_data + m_size;
+    }
+
+    ConstReverseArrayIterator<T> crbegin() const {
+        return m_data + m_size;
+    }
+
+    ArrayIterator<T> end() {
+        return m_data + m_size;
+    }
+
+    ConstArrayIterator<T> cend() const {
+        return m_data + m_size;
+    }
+
+    ReverseArrayIterator<T> rend() {
+        return m_data;
+    }
+
+    ConstReverseArrayIterator<T> crend() const {
+        return m_data;
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the vector
+     * 
+     * @tparam Function callable as void(T const &)
+     * @param f
+     */
+    template<typename Function>
+    Derived const &forEach(Function &&f) const {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            f(m_data[i]);
+        }
+        return derived();
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the referce to the vector element
+     * 
+     * @tparam Function callable as void(T &)
+     * @param f
+     */
+    template<typename Function>
+    Derived &transformReference(Function &&f) {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            f(m_data[i]);
+        }
+        return derived();
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element
+     * 
+     * @tparam Function callable as T(T const &)
+     * @param f
+     */
+    template<typename Function>
+    Derived &transformAndCopy(Function &&f) {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            m_data[i] = f(m_data[i]);
+        }
+        return derived();
+    }
+
+    /**
+     * @brief Applies Lambda that is not modifying the vector
+     * 
+     * @tparam Function callable as void(T const &, size_t)
+     * @param f
+     */
+    template<typename Function>
+    Derived const &forEachWithIndex(Function &&f) const {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            f(m_data[i], i);
+        }
+        return derived();
+    }
+
+    /**
+     * @brief Applies Lambda that is modifying the referce to the vector element
+     * 
+     * @tparam Function callable as void(T &, size_t)
+     * @param f
+     */
+    template<typename Function>
+    Derived &transformReferenceWithIndex(Function &&f) {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            f(m_data[i], i);
+        }
+        return derived();
+    }
+
+    /**
+     * @brief Applies Lambda that returns copy of modified element
+     * 
+     * @tparam Function callable as T(T const &, size_t)
+     * @param f
+     */
+    template<typename Function>
+    Derived &transformAndCopyWithIndex(Function &&f) {
+        for (size_t i = 0; i < m_size; i++)
+        {
+            m_data[i] = f(m_data[i], i);
+        }
+        return derived();
+    }
+
+    bool operator==(Derived const &rhs) const {
+        if(m_size != rhs.size()) return false;
+        for (size_t i = 0; i < m_size; i++)
+        {
+            if(m_data[i] != rhs[i]) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(Derived const &rhs) const {
+        return !(*this == rhs);
+    }
+
+    bool contains(T const &val) const {
+        for (size_t i = 0; i < m_size; i++) {
+            if(m_data[i] == val) return true;
+        }
+        return false;
+    }
+};
+
+template<typename Derived, typename T>
+void printVector(BasicVector<Derived, T> const &vec) {
+    print("{");
+    for (size_t i = 0; i < vec.size(); i++)
+    {
+        print(vec[i]);
+        if(i < vec.size() - 1) print(", ");
+    }
+    print("}");
+}
+
+/**
+ * @brief growable Array of orbitrary type, elements are stored contiguously
+ * and iterated with the Array iterators. data() is nullptr until something is reserved
+ * 
+ * @tparam T type
+ */
+template<typename T>
+class Vector : public BasicVector<Vector<T>, T> {
+    friend class BasicVector<Vector<T>, T>;
+    using BasicVector<Vector<T>, T>::m_data;
+    using BasicVector<Vector<T>, T>::m_size;
+    using BasicVector<Vector<T>, T>::m_capacity;
+
+    bool ownsStorage() const {
+        return m_data != nullptr;
+    }
+
+public:
+    using BasicVector<Vector<T>, T>::emplaceBack;
+    using BasicVector<Vector<T>, T>::reserve;
+    using BasicVector<Vector<T>, T>::clear;
+
+    Vector() = default;
+
+    /**
+     * @brief Construct a new Vector object with size elements equal to val
+     * 
+     * @param size
+     * @param val
+     */
+    explicit Vector(size_t size, T const &val = T()) {
+        reserve(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            emplaceBack(val);
+        }
+    }
+
+    /**
+     * @brief Construct a new Vector object from std::initalizer_list
+     * 
+     * @param val
+     */
+    Vector(std::initializer_list<T> const &val) {
+        reserve(val.size());
+        for (T const &element : val) {
+            emplaceBack(element);
+        }
+    }
+
+    Vector(Vector const &vec) : BasicVector<Vector<T>, T>() {
+        reserve(vec.m_size);
+        for (size_t i = 0; i < vec.m_size; i++)
+        {
+            emplaceBack(vec.m_data[i]);
+        }
+    }
+
+    Vector(Vector &&vec) noexcept {
+        swap(vec);
+    }
+
+    ~Vector() {
+        clear();
+        this->releaseStorage();
+    }
+
+    Vector &operator=(Vector const &vec) {
+        if(this != &vec) {
+            Vector copy(vec);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    Vector &operator=(Vector &&vec) noexcept {
+        Vector moved(std::move(vec));
+        swap(moved);
+        return *this;
+    }
+
+    Vector &swap(Vector &vec) noexcept {
+        std::swap(m_data, vec.m_data);
+        std::swap(m_size, vec.m_size);
+        std::swap(m_capacity, vec.m_capacity);
+        return *this;
+    }
+
+    /**
+     * @brief releases the capacity that is not used by elements
+     * 
+     */
+    Vector &shrinkToFit() {
+        if(m_size == m_capacity) return *this;
+        if(m_size == 0) {
+            vectorDeallocate(m_data);
+            m_data = nullptr;
+            m_capacity = 0;
+            return *this;
+        }
+        this->reallocate(m_size);
+        return *this;
+    }
+
+    /**
+     * @brief appends copies of n elements starting at data, growing at most once.
+     * The copies are made before the old elements are relocated, so data may point into this Vector
+     * 
+     * @param data
+     * @param n
+     */
+    Vector &append(T const *data, size_t n) {
+        if(m_size + n <= m_capacity) {
+            vectorCopy(data, n, m_data + m_size);
+            m_size += n;
+            return *this;
+        }
+        size_t capacity = vectorGrowth(m_capacity, m_size + n);
+        T *storage = vectorAllocate<T>(capacity);
+        try {
+            vectorCopy(data, n, storage + m_size);
+        } catch(...) {
+            vectorDeallocate(storage);
+            throw;
+        }
+        try {
+            vectorRelocate(m_data, m_size, storage);
+        } catch(...) {
+            vectorDestroy(storage + m_size, n);
+            vectorDeallocate(storage);
+            throw;
+        }
+        this->releaseStorage();
+        m_data = storage;
+        m_size += n;
+        m_capacity = capacity;
+        return *this;
+    }
+};
+
+template<typename T>
+void print(Vector<T> const &vec) {
+    printVector(vec);
+}
+
+} // namespace TAS